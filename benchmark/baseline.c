@@ -0,0 +1,341 @@
+/**
+ * @file baseline.c
+ * @brief 기준 결과 비교 구현부
+ *
+ * JSON은 벤치마크가 직접 쓴 형식만 읽으면 되므로 범용 파서 대신 결과마다 필요한 키만 찾음
+ * (한 결과의 범위는 "algorithm" 키부터 다음 "algorithm" 키 직전까지이며, 공백과 줄바꿈 위치는 상관없음)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "baseline.h"
+
+#define CI_Z 1.959963984540054 // 95% 양측 신뢰 구간
+#define MIN_TIME 1e-12         // 비율 계산을 위해 0초 측정을 보정
+
+static char *read_file(const char *path);
+static const char *find_value(const char *begin, const char *end, const char *key);
+static int read_string(const char *ptr, const char *end, char *dst, size_t capacity);
+static int read_times(const char *ptr, const char *end, BaselineEntry *entry);
+static int compare_double(const void *a, const void *b);
+static double median_of(const double *times, int count);
+
+/* [공개 함수] 기준 파일 불러오기 */
+int baseline_load(const char *path, Baseline *out)
+{
+    out->entries = NULL;
+    out->num_entries = 0;
+    char *text = read_file(path);
+    if (text == NULL)
+    {
+        return -1;
+    }
+
+    size_t capacity = 0;
+    const char *cursor = strstr(text, "\"algorithm\"");
+    while (cursor != NULL)
+    {
+        const char *next = strstr(cursor + 1, "\"algorithm\"");
+        const char *end = (next != NULL) ? next : cursor + strlen(cursor);
+
+        BaselineEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        const char *n_value = find_value(cursor, end, "n");
+        const char *threads_value = find_value(cursor, end, "threads");
+        const char *times_value = find_value(cursor, end, "times");
+        if (read_string(find_value(cursor, end, "algorithm"), end, entry.algorithm, sizeof(entry.algorithm)) == 0
+            && read_string(find_value(cursor, end, "type"), end, entry.type, sizeof(entry.type)) == 0
+            && read_string(find_value(cursor, end, "distribution"), end, entry.distribution, sizeof(entry.distribution)) == 0
+            && n_value != NULL && times_value != NULL)
+        {
+            entry.num_of_elements = (size_t)strtoull(n_value, NULL, 10);
+            entry.num_threads = (threads_value != NULL) ? atoi(threads_value) : 0;
+            if (read_times(times_value, end, &entry) != 0)
+            {
+                free(text);
+                baseline_free(out);
+                return -1;
+            }
+        }
+        if (entry.num_times > 0)
+        {
+            if (out->num_entries == capacity)
+            {
+                size_t new_capacity = capacity ? capacity * 2 : 16;
+                BaselineEntry *entries = (BaselineEntry *)realloc(out->entries, new_capacity * sizeof(BaselineEntry));
+                if (entries == NULL)
+                {
+                    free(entry.times);
+                    free(text);
+                    baseline_free(out);
+                    return -1;
+                }
+                out->entries = entries;
+                capacity = new_capacity;
+            }
+            out->entries[out->num_entries++] = entry;
+        }
+        else
+        {
+            free(entry.times);
+        }
+        cursor = next;
+    }
+    free(text);
+    return 0;
+}
+
+/* [공개 함수] 기준 결과 해제 */
+void baseline_free(Baseline *baseline)
+{
+    for (size_t i = 0; i < baseline->num_entries; i++)
+    {
+        free(baseline->entries[i].times);
+    }
+    free(baseline->entries);
+    baseline->entries = NULL;
+    baseline->num_entries = 0;
+}
+
+/* [공개 함수] 같은 조건의 기준 결과 찾기 */
+const BaselineEntry *baseline_find(const Baseline *baseline, const char *algorithm, const char *type, const char *distribution, size_t num_of_elements, int num_threads)
+{
+    for (size_t i = 0; i < baseline->num_entries; i++)
+    {
+        const BaselineEntry *entry = &baseline->entries[i];
+        if (entry->num_of_elements == num_of_elements && entry->num_threads == num_threads && strcmp(entry->algorithm, algorithm) == 0
+            && strcmp(entry->type, type) == 0 && strcmp(entry->distribution, distribution) == 0)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/* [공개 함수] 두 표본 비교 */
+int baseline_compare(const double *baseline_times, int num_baseline, const double *current_times, int num_current,
+                     double alpha, double tolerance, BaselineComparison *out)
+{
+    memset(out, 0, sizeof(BaselineComparison));
+    out->p_value = 1.0;
+    out->ratio = out->ratio_low = out->ratio_high = 1.0;
+    if (num_baseline <= 0 || num_current <= 0)
+    {
+        return 0;
+    }
+    size_t m = (size_t)num_baseline;
+    size_t n = (size_t)num_current;
+    size_t num_pairs = m * n;
+    double *pooled = (double *)malloc((m + n) * sizeof(double));
+    double *log_ratios = (double *)malloc(num_pairs * sizeof(double));
+    if (pooled == NULL || log_ratios == NULL)
+    {
+        free(pooled);
+        free(log_ratios);
+        return -1;
+    }
+    out->baseline_median = median_of(baseline_times, num_baseline);
+    out->current_median = median_of(current_times, num_current);
+
+    /* U: 현재 측정이 기준보다 오래 걸린 쌍의 수 (같으면 0.5), 모든 쌍의 시간 비율도 함께 구함 */
+    double u = 0.0;
+    for (size_t i = 0; i < m; i++)
+    {
+        double base = (baseline_times[i] > MIN_TIME) ? baseline_times[i] : MIN_TIME;
+        for (size_t j = 0; j < n; j++)
+        {
+            double current = (current_times[j] > MIN_TIME) ? current_times[j] : MIN_TIME;
+            u += (current > base) ? 1.0 : (current == base) ? 0.5 : 0.0;
+            log_ratios[i * n + j] = log(current / base);
+        }
+    }
+
+    /* 동순위 보정: 같은 값 t개마다 t^3 - t */
+    memcpy(pooled, baseline_times, m * sizeof(double));
+    memcpy(pooled + m, current_times, n * sizeof(double));
+    qsort(pooled, m + n, sizeof(double), compare_double);
+    double tie_sum = 0.0;
+    for (size_t i = 0; i < m + n;)
+    {
+        size_t j = i + 1;
+        while (j < m + n && pooled[j] == pooled[i])
+        {
+            j++;
+        }
+        double t = (double)(j - i);
+        tie_sum += t * t * t - t;
+        i = j;
+    }
+    double total = (double)(m + n);
+    double mean = (double)num_pairs / 2.0;
+    double variance = (double)num_pairs / 12.0 * ((total + 1.0) - tie_sum / (total * (total - 1.0)));
+
+    /* Hodges-Lehmann 추정값과 Moses 신뢰 구간 (정렬된 쌍별 비율의 순서 통계량) */
+    qsort(log_ratios, num_pairs, sizeof(double), compare_double);
+    out->ratio = exp((num_pairs % 2) ? log_ratios[num_pairs / 2] : (log_ratios[num_pairs / 2 - 1] + log_ratios[num_pairs / 2]) / 2.0);
+    double rank = floor(mean - CI_Z * sqrt((double)num_pairs * (total + 1.0) / 12.0));
+    size_t k = (rank >= 1.0) ? (size_t)rank : 1;
+    out->ratio_low = exp(log_ratios[k - 1]);
+    out->ratio_high = exp(log_ratios[num_pairs - k]);
+
+    /* 연속성 보정한 정규 근사, 분산이 0이면(모든 값이 같음) 차이 없음 */
+    if (variance > 0.0)
+    {
+        double sd = sqrt(variance);
+        double z = (out->ratio >= 1.0) ? (u - mean - 0.5) / sd : (mean - u - 0.5) / sd;
+        out->p_value = 0.5 * erfc(z / sqrt(2.0));
+    }
+    out->is_regression = (out->ratio >= 1.0 && out->p_value < alpha && out->ratio > 1.0 + tolerance);
+    out->is_improvement = (out->ratio < 1.0 && out->p_value < alpha && out->ratio < 1.0 / (1.0 + tolerance));
+
+    free(pooled);
+    free(log_ratios);
+    return 0;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    size_t capacity = 1 << 16;
+    size_t length = 0;
+    char *text = (char *)malloc(capacity);
+    while (text != NULL)
+    {
+        length += fread(text + length, 1, capacity - length - 1, file);
+        if (length < capacity - 1)
+        {
+            break;
+        }
+        char *grown = (char *)realloc(text, capacity * 2);
+        if (grown == NULL)
+        {
+            free(text);
+            text = NULL;
+            break;
+        }
+        text = grown;
+        capacity *= 2;
+    }
+    int has_error = ferror(file);
+    fclose(file);
+    if (text == NULL || has_error)
+    {
+        free(text);
+        return NULL;
+    }
+    text[length] = '\0';
+    return text;
+}
+
+/* [begin, end) 안에서 "key": 다음의 값 위치, 없으면 NULL */
+static const char *find_value(const char *begin, const char *end, const char *key)
+{
+    size_t key_length = strlen(key);
+    for (const char *p = begin; p + key_length + 2 <= end; p++)
+    {
+        if (p[0] != '"' || strncmp(p + 1, key, key_length) != 0 || p[key_length + 1] != '"')
+        {
+            continue;
+        }
+        const char *value = p + key_length + 2;
+        while (value < end && (*value == ' ' || *value == '\t' || *value == '\r' || *value == '\n'))
+        {
+            value++;
+        }
+        if (value >= end || *value != ':')
+        {
+            continue;
+        }
+        value++;
+        while (value < end && (*value == ' ' || *value == '\t' || *value == '\r' || *value == '\n'))
+        {
+            value++;
+        }
+        return value;
+    }
+    return NULL;
+}
+
+static int read_string(const char *ptr, const char *end, char *dst, size_t capacity)
+{
+    if (ptr == NULL || ptr >= end || *ptr != '"')
+    {
+        return -1;
+    }
+    ptr++;
+    size_t length = 0;
+    while (ptr < end && *ptr != '"')
+    {
+        if (length + 1 >= capacity)
+        {
+            return -1;
+        }
+        dst[length++] = *ptr++;
+    }
+    dst[length] = '\0';
+    return (ptr < end) ? 0 : -1;
+}
+
+/* [t0, t1, ...] 형식, 메모리 할당 실패 시에만 -1 */
+static int read_times(const char *ptr, const char *end, BaselineEntry *entry)
+{
+    if (ptr >= end || *ptr != '[')
+    {
+        return 0;
+    }
+    int capacity = 0;
+    ptr++;
+    while (ptr < end && *ptr != ']')
+    {
+        char *number_end = NULL;
+        double value = strtod(ptr, &number_end);
+        if (number_end == ptr)
+        {
+            ptr++; // 쉼표, 공백
+            continue;
+        }
+        if (entry->num_times == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 8;
+            double *times = (double *)realloc(entry->times, (size_t)capacity * sizeof(double));
+            if (times == NULL)
+            {
+                free(entry->times);
+                entry->times = NULL;
+                entry->num_times = 0;
+                return -1;
+            }
+            entry->times = times;
+        }
+        entry->times[entry->num_times++] = value;
+        ptr = number_end;
+    }
+    return 0;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    const double val_a = *(const double *)a;
+    const double val_b = *(const double *)b;
+    return (val_a > val_b) - (val_a < val_b);
+}
+
+static double median_of(const double *times, int count)
+{
+    double *sorted = (double *)malloc((size_t)count * sizeof(double));
+    if (sorted == NULL)
+    {
+        return times[count / 2];
+    }
+    memcpy(sorted, times, (size_t)count * sizeof(double));
+    qsort(sorted, (size_t)count, sizeof(double), compare_double);
+    double median = (count % 2) ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+    free(sorted);
+    return median;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file baseline.h
+ *
+ * @brief 기준(baseline) 결과와 새 측정의 통계적 비교
+ *
+ * 벤치마크의 --json 출력 파일을 기준으로 불러와, 같은 알고리즘 / 자료형 / 분포 / 데이터 개수의
+ * 측정 시간 표본을 Mann-Whitney U 검정(단측, 정규 근사 + 동순위 보정)으로 비교
+ * 시간 비율은 Hodges-Lehmann 추정값(모든 쌍의 비율의 중앙값)과 95% 신뢰 구간으로 나타냄
+ *
+ * */
+
+#ifndef BASELINE_H
+#define BASELINE_H
+
+#include <stddef.h>
+
+/* 기준 파일의 결과 하나 (측정 시간은 초 단위) */
+typedef struct BaselineEntryStruct
+{
+    char algorithm[48];
+    char type[16];
+    char distribution[32];
+    size_t num_of_elements;
+    int num_threads;        // 고정한 작업 스레드 수, 0이면 자동 (--threads 없이 측정)
+    double *times;
+    int num_times;
+} BaselineEntry;
+
+typedef struct BaselineStruct
+{
+    BaselineEntry *entries;
+    size_t num_entries;
+} Baseline;
+
+/* 비교 결과 */
+typedef struct BaselineComparisonStruct
+{
+    double baseline_median;
+    double current_median;
+    double ratio;           // 현재 / 기준 시간 비율의 Hodges-Lehmann 추정값 (1.10이면 10% 느려짐)
+    double ratio_low;       // ratio의 95% 신뢰 구간
+    double ratio_high;
+    double p_value;         // 변화 방향의 단측 검정 p값 (ratio >= 1이면 '현재가 더 느리다', 아니면 '더 빠르다'는 대립 가설)
+    int is_regression;      // p_value < alpha이고 ratio > 1 + tolerance
+    int is_improvement;     // 반대 방향으로 같은 조건을 만족
+} BaselineComparison;
+
+/**
+ * @brief 벤치마크 JSON 파일 불러오기
+ *
+ * "times" 배열이 없는 결과(건너뛰었거나 실패한 측정)는 무시함
+ *
+ * @return 파일을 읽지 못했거나 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int baseline_load(const char *path, Baseline *out);
+
+void baseline_free(Baseline *baseline);
+
+/**
+ * @brief 같은 조건의 기준 결과 찾기
+ *
+ * @return 없으면 NULL을 반환
+ *
+ */
+const BaselineEntry *baseline_find(const Baseline *baseline, const char *algorithm, const char *type, const char *distribution, size_t num_of_elements, int num_threads);
+
+/**
+ * @brief 두 측정 시간 표본 비교
+ *
+ * @param alpha 유의 수준 (예: 0.05)
+ * @param tolerance 무시할 변화 비율 (예: 0.05면 5% 이내의 변화는 유의해도 회귀로 보지 않음)
+ *
+ * @return 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int baseline_compare(const double *baseline_times, int num_baseline, const double *current_times, int num_current,
+                     double alpha, double tolerance, BaselineComparison *out);
+
+#endif // BASELINE_H
@@ -0,0 +1,1140 @@
+/**
+ * @file benchmark.c
+ * @brief 정렬 라이브러리 통합 벤치마크 (Windows / Linux 공용)
+ *
+ * 알고리즘, 자료형, 데이터 개수, 분포를 옵션으로 골라 워밍업 후 반복 측정하고
+ * 중앙값 / p95 / 초당 처리 원소 수를 표로 출력 (--csv, --json으로 파일 저장)
+ *
+ * --threads로 작업 스레드 수를 바꿔 가며 측정하면 스레드 수에 따른 가속비와 병렬 효율을 출력 (--weak이면 스레드당 데이터 개수 고정)
+ * --baseline으로 이전 --json 결과를 주면 같은 조건끼리 측정 시간을 통계적으로 비교하여 유의하게 느려진 항목을 표시
+ *
+ * 예) ./benchmark -a merge_sort,merge_sort_multi -t int,double -n 1m,10m -r 7 --csv result.csv
+ *     ./benchmark -r 15 --json base.json                 (변경 전)
+ *     ./benchmark -r 15 --baseline base.json             (변경 후, 회귀가 있으면 종료 코드 3)
+ *     ./benchmark -a merge_sort_multi -t int -n 1k..1g --threads all --scaling-csv scaling.csv
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../library/sorting.h"
+#include "../library/sort_internal.h" // 단조 시계(sort_now_seconds)와 코어 수
+#include "generators.h"
+#include "perf_counters.h"
+#include "baseline.h"
+#include "mem_usage.h"
+
+// ==========================================
+// 1. 자료형과 비교 함수
+// ==========================================
+
+static int compare_int(const void *a, const void *b)
+{
+    const int val_a = *(const int *)a;
+    const int val_b = *(const int *)b;
+    return (val_a > val_b) - (val_a < val_b);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    const double val_a = *(const double *)a;
+    const double val_b = *(const double *)b;
+    return (val_a > val_b) - (val_a < val_b);
+}
+
+// 점수 내림차순, 같은 점수는 ID 오름차순
+static int compare_student(const void *a, const void *b)
+{
+    const Student *sa = (const Student *)a;
+    const Student *sb = (const Student *)b;
+    if (sa->score != sb->score)
+    {
+        return (sb->score > sa->score) - (sb->score < sa->score);
+    }
+    return (sa->id > sb->id) - (sa->id < sb->id);
+}
+
+typedef struct
+{
+    const char *name;
+    GenType gen_type;
+    size_t size_of_element;
+    int (*cmp)(const void *, const void *);
+} BenchType;
+
+static const BenchType bench_types[] = {
+    {"int", GEN_TYPE_INT, sizeof(int), compare_int},
+    {"double", GEN_TYPE_DOUBLE, sizeof(double), compare_double},
+    {"student", GEN_TYPE_STUDENT, sizeof(Student), compare_student},
+};
+
+// ==========================================
+// 2. 알고리즘 목록
+// ==========================================
+
+typedef int (*SortFunction)(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+// 반환값이 없는 정렬을 같은 형태로 감쌈
+static int run_bubble_sort(void *arr, size_t n, size_t size, int (*cmp)(const void *, const void *))
+{
+    bubble_sort(arr, n, size, cmp);
+    return 0;
+}
+
+static int run_insertion_sort(void *arr, size_t n, size_t size, int (*cmp)(const void *, const void *))
+{
+    insertion_sort(arr, n, size, cmp);
+    return 0;
+}
+
+static int run_insertion_sort_binary(void *arr, size_t n, size_t size, int (*cmp)(const void *, const void *))
+{
+    insertion_sort_binary(arr, n, size, cmp);
+    return 0;
+}
+
+static int run_bogo_sort(void *arr, size_t n, size_t size, int (*cmp)(const void *, const void *))
+{
+    bogo_sort(arr, n, size, cmp);
+    return 0;
+}
+
+typedef struct
+{
+    const char *name;
+    SortFunction func;
+    size_t max_elements;    // 이보다 많으면 --force 없이는 건너뜀 (0이면 제한 없음)
+} BenchAlgorithm;
+
+static const BenchAlgorithm bench_algorithms[] = {
+    {"merge_sort", merge_sort, 0},
+    {"merge_sort_multi", merge_sort_multi, 0},
+    {"merge_sort_pp", merge_sort_pp, 0},
+    {"merge_sort_numa", merge_sort_numa, 0},
+    {"sample_sort_multi", sample_sort_multi, 0},
+    {"sort_few_unique", sort_few_unique, 0},
+    {"auto_sort", auto_sort, 0},
+    {"insertion_sort", run_insertion_sort, 100000},
+    {"insertion_sort_binary", run_insertion_sort_binary, 200000},
+    {"bubble_sort", run_bubble_sort, 50000},
+    {"bogo_sort", run_bogo_sort, 10},
+};
+
+#define NUM_TYPES (sizeof(bench_types) / sizeof(bench_types[0]))
+#define NUM_ALGORITHMS (sizeof(bench_algorithms) / sizeof(bench_algorithms[0]))
+
+// ==========================================
+// 3. 측정과 통계
+// ==========================================
+
+/* --memory일 때 측정한 메모리 사용량 (최대값은 측정들 중 최대, 페이지 폴트는 측정 1회당 평균) */
+typedef struct
+{
+    size_t scratch_peak;                // 라이브러리 작업 공간의 최대 동시 사용량 (바이트)
+    size_t rss_growth;                  // 정렬 중 최대 RSS - 정렬 직전 RSS (has_rss_growth가 0이면 측정 불가)
+    int has_rss_growth;
+    size_t peak_rss;                    // 프로세스 최대 RSS (has_rss_growth가 0이면 프로세스 시작 이후 전체의 최대값)
+    unsigned long long minor_faults;
+    unsigned long long major_faults;
+} BenchMemory;
+
+typedef struct
+{
+    const char *algorithm;
+    const char *type;
+    const char *distribution;
+    size_t num_of_elements;
+    size_t sweep_size;      // -n으로 지정한 개수 (--weak이면 스레드당 개수)
+    int num_threads;        // 고정한 작업 스레드 수, 0이면 자동
+    int trials;
+    double min_sec;
+    double mean_sec;
+    double median_sec;
+    double p95_sec;
+    double elements_per_sec;
+    double *times;          // 정렬된 측정 시간 (trials개)
+    const char *status;     // OK, FAIL(정렬 안 됨 또는 원소 손실), ERR(정렬 함수 실패), OOM, SKIP
+    int has_stats;          // 계측 빌드(-DSORT_STATS)이면 마지막 측정의 카운터가 stats에 기록됨
+    SortStats stats;
+    PerfSample perf;        // --perf일 때 측정 1회당 평균 하드웨어 카운터 값
+    int has_memory;
+    BenchMemory memory;
+} BenchResult;
+
+typedef struct
+{
+    const char **algorithms;
+    size_t num_algorithms;
+    const char **types;
+    size_t num_types;
+    const char **distributions;
+    size_t num_distributions;
+    size_t *sizes;
+    size_t num_sizes;
+    int *thread_counts;     // --threads가 없으면 {0} (자동) 하나
+    size_t num_thread_counts;
+    int is_weak;
+    const char *scaling_csv_path;
+    int warmup;
+    int trials;
+    uint64_t seed;
+    GenParams gen_params;
+    int verify;
+    int force;
+    const char *csv_path;
+    const char *json_path;
+    const char *trace_path;
+    int use_perf;
+    PerfCounters *perf;     // 하드웨어 카운터를 열지 못했으면 NULL
+    int track_memory;
+    const char *baseline_path;
+    double alpha;           // 회귀 판정 유의 수준
+    double tolerance;       // 이 비율 이내의 변화는 회귀로 보지 않음
+} BenchConfig;
+
+// 워밍업 후 trials회 측정, source는 매번 work로 복사하여 같은 입력을 정렬
+static void measure(const BenchConfig *config, const BenchAlgorithm *algorithm, const BenchType *type, const void *source, void *work, size_t n, BenchResult *result)
+{
+    double *times = result->times;
+    result->status = "OK";
+    memset(&result->perf, 0, sizeof(PerfSample));
+    memset(&result->memory, 0, sizeof(BenchMemory));
+    result->memory.has_rss_growth = 1;
+    size_t bytes = n * type->size_of_element;
+    unsigned long long source_checksum = config->verify ? sort_checksum(source, n, type->size_of_element) : 0;
+    for (int trial = -config->warmup; trial < config->trials; trial++)
+    {
+        memcpy(work, source, bytes);
+        sort_stats_reset();
+        MemUsage before;
+        int is_peak_reset = 0;
+        if (config->track_memory)
+        {
+            mem_tracker_reset();
+            is_peak_reset = (mem_usage_reset_peak() == 0);
+            mem_usage_read(&before);
+        }
+        if (config->perf != NULL)
+        {
+            perf_counters_start(config->perf);
+        }
+        double start = sort_now_seconds();
+        int ret = algorithm->func(work, n, type->size_of_element, type->cmp);
+        double elapsed = sort_now_seconds() - start;
+        PerfSample sample;
+        if (config->perf != NULL)
+        {
+            perf_counters_stop(config->perf, &sample);
+        }
+        if (ret != 0)
+        {
+            result->status = "ERR";
+            return;
+        }
+        if (config->track_memory && trial >= 0)
+        {
+            MemUsage after;
+            mem_usage_read(&after);
+            BenchMemory *memory = &result->memory;
+            size_t scratch_peak = mem_tracker_peak();
+            size_t rss_growth = (after.peak_rss > before.current_rss) ? after.peak_rss - before.current_rss : 0;
+            memory->scratch_peak = (scratch_peak > memory->scratch_peak) ? scratch_peak : memory->scratch_peak;
+            memory->rss_growth = (rss_growth > memory->rss_growth) ? rss_growth : memory->rss_growth;
+            memory->has_rss_growth &= is_peak_reset;
+            memory->peak_rss = (after.peak_rss > memory->peak_rss) ? after.peak_rss : memory->peak_rss;
+            memory->minor_faults += after.minor_faults - before.minor_faults;
+            memory->major_faults += after.major_faults - before.major_faults;
+        }
+        if (trial >= 0)
+        {
+            times[trial] = elapsed;
+            for (int e = 0; config->perf != NULL && e < PERF_NUM_EVENTS; e++)
+            {
+                result->perf.values[e] += sample.values[e] / (unsigned long long)config->trials;
+                result->perf.is_valid[e] = sample.is_valid[e];
+            }
+        }
+    }
+    result->has_stats = (sort_stats_get(&result->stats) == 0);
+    result->has_memory = config->track_memory;
+    result->memory.minor_faults /= (unsigned long long)config->trials;
+    result->memory.major_faults /= (unsigned long long)config->trials;
+    /* 정렬 여부와 함께 체크섬으로 원소가 사라지거나 중복되지 않았는지(입력의 순열인지) 확인 */
+    if (config->verify && (!sort_is_sorted(work, n, type->size_of_element, type->cmp)
+                           || sort_checksum(work, n, type->size_of_element) != source_checksum))
+    {
+        result->status = "FAIL";
+    }
+
+    qsort(times, (size_t)config->trials, sizeof(double), compare_double);
+    double sum = 0.0;
+    for (int i = 0; i < config->trials; i++)
+    {
+        sum += times[i];
+    }
+    int k = config->trials;
+    int p95_index = (95 * k + 99) / 100 - 1; // nearest-rank
+    result->min_sec = times[0];
+    result->mean_sec = sum / k;
+    result->median_sec = (k % 2) ? times[k / 2] : (times[k / 2 - 1] + times[k / 2]) / 2.0;
+    result->p95_sec = times[p95_index < 0 ? 0 : p95_index];
+    result->elements_per_sec = (result->median_sec > 0.0) ? (double)n / result->median_sec : 0.0;
+}
+
+// ==========================================
+// 4. 결과 출력
+// ==========================================
+
+static void print_header(void)
+{
+    printf("| %-22s | %-8s | %-13s | %12s | %7s | %12s | %12s | %10s | %-6s |\n",
+           "Algorithm", "Type", "Dist", "Data Count", "Threads", "Median (s)", "p95 (s)", "Melem/s", "Status");
+    printf("|------------------------|----------|---------------|--------------|---------|--------------|--------------|------------|--------|\n");
+}
+
+// 스레드 수 표시, 0은 자동
+static void threads_text(int num_threads, char *buf, size_t size)
+{
+    if (num_threads <= 0)
+    {
+        snprintf(buf, size, "auto");
+        return;
+    }
+    snprintf(buf, size, "%d", num_threads);
+}
+
+static void print_result(const BenchResult *result)
+{
+    char threads[16];
+    threads_text(result->num_threads, threads, sizeof(threads));
+    if (result->trials == 0)
+    {
+        printf("| %-22s | %-8s | %-13s | %12llu | %7s | %12s | %12s | %10s | %-6s |\n",
+               result->algorithm, result->type, result->distribution, (unsigned long long)result->num_of_elements, threads, "-", "-", "-", result->status);
+        return;
+    }
+    printf("| %-22s | %-8s | %-13s | %12llu | %7s | %12.6f | %12.6f | %10.2f | %-6s |\n",
+           result->algorithm, result->type, result->distribution, (unsigned long long)result->num_of_elements, threads,
+           result->median_sec, result->p95_sec, result->elements_per_sec / 1e6, result->status);
+    if (result->has_stats)
+    {
+        const SortStats *stats = &result->stats;
+        double n = (result->num_of_elements > 0) ? (double)result->num_of_elements : 1.0;
+        printf("|   stats: %.2f cmp/elem, %.1f copied B/elem, %llu swaps, %llu allocs (%llu B), %llu threads\n",
+               (double)stats->comparisons / n, (double)stats->bytes_copied / n, (unsigned long long)stats->swaps,
+               (unsigned long long)stats->allocations, (unsigned long long)stats->bytes_allocated, (unsigned long long)stats->thread_spawns);
+    }
+    if (result->has_memory)
+    {
+        const BenchMemory *memory = &result->memory;
+        double n = (result->num_of_elements > 0) ? (double)result->num_of_elements : 1.0;
+        printf("|   memory: scratch %.2f B/elem (%.1f MiB),", (double)memory->scratch_peak / n, (double)memory->scratch_peak / 1048576.0);
+        if (memory->has_rss_growth)
+        {
+            printf(" RSS +%.2f B/elem (peak %.1f MiB),", (double)memory->rss_growth / n, (double)memory->peak_rss / 1048576.0);
+        }
+        else
+        {
+            printf(" RSS peak %.1f MiB (whole process),", (double)memory->peak_rss / 1048576.0);
+        }
+        printf(" page faults %llu minor / %llu major\n", memory->minor_faults, memory->major_faults);
+    }
+    const PerfSample *perf = &result->perf;
+    if (perf->is_valid[PERF_EVENT_CYCLES] || perf->is_valid[PERF_EVENT_INSTRUCTIONS] || perf->is_valid[PERF_EVENT_BRANCH_MISSES]
+        || perf->is_valid[PERF_EVENT_LLC_MISSES] || perf->is_valid[PERF_EVENT_DTLB_MISSES])
+    {
+        double n = (result->num_of_elements > 0) ? (double)result->num_of_elements : 1.0;
+        printf("|   perf:");
+        if (perf->is_valid[PERF_EVENT_CYCLES] && perf->is_valid[PERF_EVENT_INSTRUCTIONS] && perf->values[PERF_EVENT_CYCLES] > 0)
+        {
+            printf(" IPC %.2f,", (double)perf->values[PERF_EVENT_INSTRUCTIONS] / (double)perf->values[PERF_EVENT_CYCLES]);
+        }
+        for (int e = 0; e < PERF_NUM_EVENTS; e++)
+        {
+            if (perf->is_valid[e])
+            {
+                printf(" %.3f %s/elem", (double)perf->values[e] / n, perf_event_name((PerfEvent)e));
+            }
+            else
+            {
+                printf(" %s n/a", perf_event_name((PerfEvent)e));
+            }
+            printf("%s", (e + 1 < PERF_NUM_EVENTS) ? "," : "\n");
+        }
+    }
+    fflush(stdout);
+}
+
+/* 측정하지 않은 값은 빈 칸 */
+static void write_csv_memory(FILE *file, const BenchResult *r)
+{
+    if (!r->has_memory)
+    {
+        fprintf(file, ",,,,,");
+        return;
+    }
+    fprintf(file, ",%llu,", (unsigned long long)r->memory.scratch_peak);
+    if (r->memory.has_rss_growth)
+    {
+        fprintf(file, "%llu", (unsigned long long)r->memory.rss_growth);
+    }
+    fprintf(file, ",%llu,%llu,%llu", (unsigned long long)r->memory.peak_rss, r->memory.minor_faults, r->memory.major_faults);
+}
+
+/* 측정하지 못한 카운터는 빈 칸 */
+static void write_csv_perf(FILE *file, const PerfSample *perf)
+{
+    for (int e = 0; e < PERF_NUM_EVENTS; e++)
+    {
+        if (perf->is_valid[e])
+        {
+            fprintf(file, ",%llu", perf->values[e]);
+        }
+        else
+        {
+            fprintf(file, ",");
+        }
+    }
+    fprintf(file, "\n");
+}
+
+static int write_csv(const char *path, const BenchResult *results, size_t num_results)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "algorithm,type,distribution,n,threads,trials,min_sec,mean_sec,median_sec,p95_sec,elements_per_sec,status,"
+                  "comparisons,bytes_copied,swaps,allocations,bytes_allocated,thread_spawns,"
+                  "scratch_peak_bytes,rss_growth_bytes,peak_rss_bytes,minor_faults,major_faults,"
+                  "cycles,instructions,branch_misses,llc_misses,dtlb_misses\n");
+    for (size_t i = 0; i < num_results; i++)
+    {
+        const BenchResult *r = &results[i];
+        fprintf(file, "%s,%s,%s,%llu,%d,%d,%.9f,%.9f,%.9f,%.9f,%.1f,%s,%llu,%llu,%llu,%llu,%llu,%llu",
+                r->algorithm, r->type, r->distribution, (unsigned long long)r->num_of_elements, r->num_threads, r->trials,
+                r->min_sec, r->mean_sec, r->median_sec, r->p95_sec, r->elements_per_sec, r->status,
+                (unsigned long long)r->stats.comparisons, (unsigned long long)r->stats.bytes_copied, (unsigned long long)r->stats.swaps,
+                (unsigned long long)r->stats.allocations, (unsigned long long)r->stats.bytes_allocated, (unsigned long long)r->stats.thread_spawns);
+        write_csv_memory(file, r);
+        write_csv_perf(file, &r->perf);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+static int write_json(const char *path, const BenchResult *results, size_t num_results)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    SortStats unused;
+    fprintf(file, "{\n  \"cpu_count\": %d,\n  \"stats_enabled\": %s,\n  \"results\": [\n", sort_cpu_count(), (sort_stats_get(&unused) == 0) ? "true" : "false");
+    for (size_t i = 0; i < num_results; i++)
+    {
+        const BenchResult *r = &results[i];
+        fprintf(file, "    {\"algorithm\": \"%s\", \"type\": \"%s\", \"distribution\": \"%s\", \"n\": %llu, \"threads\": %d, \"trials\": %d, "
+                      "\"min_sec\": %.9f, \"mean_sec\": %.9f, \"median_sec\": %.9f, \"p95_sec\": %.9f, \"elements_per_sec\": %.1f, \"status\": \"%s\"",
+                r->algorithm, r->type, r->distribution, (unsigned long long)r->num_of_elements, r->num_threads, r->trials,
+                r->min_sec, r->mean_sec, r->median_sec, r->p95_sec, r->elements_per_sec, r->status);
+        for (int k = 0; k < r->trials; k++)
+        {
+            fprintf(file, "%s%.9f%s", (k == 0) ? ", \"times\": [" : ", ", r->times[k], (k + 1 == r->trials) ? "]" : "");
+        }
+        if (r->has_stats)
+        {
+            fprintf(file, ", \"stats\": {\"comparisons\": %llu, \"bytes_copied\": %llu, \"swaps\": %llu, \"allocations\": %llu, \"bytes_allocated\": %llu, \"thread_spawns\": %llu}",
+                    (unsigned long long)r->stats.comparisons, (unsigned long long)r->stats.bytes_copied, (unsigned long long)r->stats.swaps,
+                    (unsigned long long)r->stats.allocations, (unsigned long long)r->stats.bytes_allocated, (unsigned long long)r->stats.thread_spawns);
+        }
+        if (r->has_memory && r->trials > 0)
+        {
+            fprintf(file, ", \"memory\": {\"scratch_peak_bytes\": %llu, ", (unsigned long long)r->memory.scratch_peak);
+            if (r->memory.has_rss_growth)
+            {
+                fprintf(file, "\"rss_growth_bytes\": %llu, ", (unsigned long long)r->memory.rss_growth);
+            }
+            fprintf(file, "\"peak_rss_bytes\": %llu, \"minor_faults\": %llu, \"major_faults\": %llu}",
+                    (unsigned long long)r->memory.peak_rss, r->memory.minor_faults, r->memory.major_faults);
+        }
+        int num_perf = 0;
+        for (int e = 0; e < PERF_NUM_EVENTS; e++)
+        {
+            if (r->perf.is_valid[e])
+            {
+                fprintf(file, "%s\"%s\": %llu", (num_perf == 0) ? ", \"perf\": {" : ", ", perf_event_name((PerfEvent)e), r->perf.values[e]);
+                num_perf++;
+            }
+        }
+        fprintf(file, "%s}%s\n", (num_perf > 0) ? "}" : "", (i + 1 < num_results) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+// 기준 결과와 비교한 표를 출력하고 회귀 항목 수를 반환 (기준 파일을 읽지 못하면 -1)
+static int compare_with_baseline(const BenchConfig *config, const BenchResult *results, size_t num_results)
+{
+    Baseline baseline;
+    if (baseline_load(config->baseline_path, &baseline) != 0)
+    {
+        fprintf(stderr, "failed to read baseline %s\n", config->baseline_path);
+        return -1;
+    }
+    printf("\nbaseline: %s (alpha %.3g, tolerance %.1f%%)\n\n", config->baseline_path, config->alpha, config->tolerance * 100.0);
+    printf("| %-22s | %-8s | %-13s | %12s | %7s | %12s | %12s | %8s | %-19s | %8s | %-10s |\n",
+           "Algorithm", "Type", "Dist", "Data Count", "Threads", "Base (s)", "Now (s)", "Change", "95% CI", "p", "Verdict");
+    printf("|------------------------|----------|---------------|--------------|---------|--------------|--------------|----------|---------------------|----------|------------|\n");
+    int num_regressions = 0;
+    for (size_t i = 0; i < num_results; i++)
+    {
+        const BenchResult *r = &results[i];
+        const BaselineEntry *entry = baseline_find(&baseline, r->algorithm, r->type, r->distribution, r->num_of_elements, r->num_threads);
+        char threads[16];
+        threads_text(r->num_threads, threads, sizeof(threads));
+        if (r->trials == 0 || entry == NULL)
+        {
+            printf("| %-22s | %-8s | %-13s | %12llu | %7s | %12s | %12s | %8s | %-19s | %8s | %-10s |\n",
+                   r->algorithm, r->type, r->distribution, (unsigned long long)r->num_of_elements, threads, "-", "-", "-", "-", "-",
+                   (r->trials == 0) ? r->status : "NO BASE");
+            continue;
+        }
+        BaselineComparison comparison;
+        if (baseline_compare(entry->times, entry->num_times, r->times, r->trials, config->alpha, config->tolerance, &comparison) != 0)
+        {
+            fprintf(stderr, "out of memory\n");
+            baseline_free(&baseline);
+            return -1;
+        }
+        char interval[32];
+        snprintf(interval, sizeof(interval), "[%+.1f%%, %+.1f%%]", (comparison.ratio_low - 1.0) * 100.0, (comparison.ratio_high - 1.0) * 100.0);
+        const char *verdict = comparison.is_regression ? "REGRESSION" : comparison.is_improvement ? "faster" : "same";
+        printf("| %-22s | %-8s | %-13s | %12llu | %7s | %12.6f | %12.6f | %+7.1f%% | %-19s | %8.4f | %-10s |\n",
+               r->algorithm, r->type, r->distribution, (unsigned long long)r->num_of_elements, threads,
+               comparison.baseline_median, comparison.current_median, (comparison.ratio - 1.0) * 100.0, interval, comparison.p_value, verdict);
+        num_regressions += comparison.is_regression;
+    }
+    baseline_free(&baseline);
+    return num_regressions;
+}
+
+// 같은 알고리즘 / 자료형 / 분포 / 지정 개수의 결과 중 스레드 수가 가장 적은 결과 (가속비의 기준)
+static const BenchResult *find_scaling_reference(const BenchResult *results, size_t num_results, const BenchResult *r)
+{
+    const BenchResult *reference = NULL;
+    for (size_t i = 0; i < num_results; i++)
+    {
+        const BenchResult *other = &results[i];
+        if (other->trials > 0 && other->sweep_size == r->sweep_size && strcmp(other->algorithm, r->algorithm) == 0
+            && strcmp(other->type, r->type) == 0 && strcmp(other->distribution, r->distribution) == 0
+            && (reference == NULL || other->num_threads < reference->num_threads))
+        {
+            reference = other;
+        }
+    }
+    return reference;
+}
+
+/*
+ * 기준(가장 적은 스레드 수 p0, 보통 1)에 대한 가속비와 병렬 효율
+ * strong: 가속비 = T(p0) / T(p), 효율 = 가속비 * p0 / p
+ * weak: 스레드당 개수가 같으므로 효율 = T(p0) / T(p), 가속비 = 효율 * p / p0 (scaled speedup)
+ */
+static void scaling_of(const BenchConfig *config, const BenchResult *reference, const BenchResult *r, double *speedup, double *efficiency)
+{
+    double ratio = (r->median_sec > 0.0) ? reference->median_sec / r->median_sec : 0.0;
+    double thread_ratio = (double)r->num_threads / (double)reference->num_threads;
+    *speedup = config->is_weak ? ratio * thread_ratio : ratio;
+    *efficiency = config->is_weak ? ratio : ratio / thread_ratio;
+}
+
+// 스레드 수별 가속비 표 출력과 CSV 저장 (--scaling-csv가 없으면 표만 출력)
+static int report_scaling(const BenchConfig *config, const BenchResult *results, size_t num_results)
+{
+    FILE *file = NULL;
+    if (config->scaling_csv_path != NULL)
+    {
+        file = fopen(config->scaling_csv_path, "w");
+        if (file == NULL)
+        {
+            return -1;
+        }
+        fprintf(file, "algorithm,type,distribution,mode,size,threads,n,median_sec,speedup,efficiency\n");
+    }
+    printf("\n%s scaling (relative to the fewest threads measured)\n\n", config->is_weak ? "weak" : "strong");
+    printf("| %-22s | %-8s | %-13s | %12s | %7s | %12s | %8s | %10s |\n",
+           "Algorithm", "Type", "Dist", "Data Count", "Threads", "Median (s)", "Speedup", "Efficiency");
+    printf("|------------------------|----------|---------------|--------------|---------|--------------|----------|------------|\n");
+    for (size_t i = 0; i < num_results; i++)
+    {
+        const BenchResult *r = &results[i];
+        const BenchResult *reference = find_scaling_reference(results, num_results, r);
+        if (r->trials == 0 || reference == NULL)
+        {
+            continue;
+        }
+        double speedup;
+        double efficiency;
+        scaling_of(config, reference, r, &speedup, &efficiency);
+        printf("| %-22s | %-8s | %-13s | %12llu | %7d | %12.6f | %8.2f | %9.1f%% |\n",
+               r->algorithm, r->type, r->distribution, (unsigned long long)r->num_of_elements, r->num_threads,
+               r->median_sec, speedup, efficiency * 100.0);
+        if (file != NULL)
+        {
+            fprintf(file, "%s,%s,%s,%s,%llu,%d,%llu,%.9f,%.4f,%.4f\n",
+                    r->algorithm, r->type, r->distribution, config->is_weak ? "weak" : "strong", (unsigned long long)r->sweep_size,
+                    r->num_threads, (unsigned long long)r->num_of_elements, r->median_sec, speedup, efficiency);
+        }
+    }
+    return (file == NULL || fclose(file) == 0) ? 0 : -1;
+}
+
+// ==========================================
+// 5. 명령행 옵션
+// ==========================================
+
+static void print_usage(const char *program)
+{
+    printf("Usage: %s [options]\n", program);
+    printf("  -a, --algorithms LIST    comma separated (default: merge_sort,merge_sort_multi,merge_sort_pp)\n");
+    printf("  -t, --types LIST         int,double,student (default: int,double,student)\n");
+    printf("  -n, --sizes LIST         element counts, k/m/g suffix allowed, A..B for every power of ten (default: 1m)\n");
+    printf("  -d, --distributions LIST input shapes, or 'all' (default: random)\n");
+    printf("  -w, --warmup N           untimed runs before measuring (default: 1)\n");
+    printf("  -r, --trials N           timed runs (default: 5)\n");
+    printf("  -s, --seed N             data seed (default: 12345)\n");
+    printf("      --swaps K            nearly_sorted: random swaps (default: n / 100)\n");
+    printf("      --runs K             sawtooth: ascending runs (default: 16)\n");
+    printf("      --unique K           few_unique / zipf: distinct values (default: 16 / 65536)\n");
+    printf("      --zipf S             zipf: exponent (default: 1.0)\n");
+    printf("      --tail R             appended_tail: random tail ratio (default: 0.01)\n");
+    printf("      --csv PATH           write results as CSV\n");
+    printf("      --json PATH          write results as JSON\n");
+    printf("      --trace PATH         write merge sort phases as Chrome trace JSON (library built with -DSORT_TRACE)\n");
+    printf("      --no-verify          skip the sortedness and permutation checks\n");
+    printf("      --force              run quadratic sorts on large inputs too\n");
+    printf("      --perf               read hardware counters (Linux perf_event_open)\n");
+    printf("      --memory             record library scratch memory, RSS growth and page faults\n");
+    printf("      --threads LIST       worker thread counts to sweep, or 'all' (1, 2, 4, ... up to the cpu count)\n");
+    printf("      --weak               with --threads: sizes are per thread (weak scaling)\n");
+    printf("      --scaling-csv PATH   write speedup and parallel efficiency per thread count as CSV\n");
+    printf("      --baseline PATH      compare against a previous --json result, exit 3 on regression\n");
+    printf("      --alpha A            significance level for --baseline (default: 0.05)\n");
+    printf("      --tolerance PCT      ignore changes within PCT percent (default: 5)\n");
+    printf("  -l, --list               list algorithms, types and distributions\n");
+    printf("  -h, --help               show this help\n");
+}
+
+static void print_list(void)
+{
+    printf("algorithms:");
+    for (size_t i = 0; i < NUM_ALGORITHMS; i++)
+    {
+        printf(" %s", bench_algorithms[i].name);
+    }
+    printf("\ntypes:");
+    for (size_t i = 0; i < NUM_TYPES; i++)
+    {
+        printf(" %s", bench_types[i].name);
+    }
+    printf("\ndistributions:");
+    for (int i = 0; i < GEN_NUM_DISTRIBUTIONS; i++)
+    {
+        printf(" %s", gen_distribution_name((GenDistribution)i));
+    }
+    printf("\n");
+}
+
+// 쉼표로 구분된 목록을 잘라서 문자열 배열로 반환 (text는 수정됨)
+static const char **split_list(char *text, size_t *out_count)
+{
+    size_t count = 1;
+    for (const char *p = text; *p; p++)
+    {
+        count += (*p == ',');
+    }
+    const char **items = (const char **)malloc(count * sizeof(char *));
+    if (items == NULL)
+    {
+        return NULL;
+    }
+    size_t index = 0;
+    for (char *token = strtok(text, ","); token != NULL; token = strtok(NULL, ","))
+    {
+        items[index++] = token;
+    }
+    *out_count = index;
+    return items;
+}
+
+// "1000", "1e6", "10m", "1.4g" 형식 (k/m/g는 1000 단위)
+static int parse_size(const char *text, size_t *out)
+{
+    char *end = NULL;
+    double value = strtod(text, &end);
+    if (end == text || value < 0.0)
+    {
+        return -1;
+    }
+    switch (*end)
+    {
+    case 'k': case 'K': value *= 1e3; end++; break;
+    case 'm': case 'M': value *= 1e6; end++; break;
+    case 'g': case 'G': value *= 1e9; end++; break;
+    default: break;
+    }
+    if (*end != '\0')
+    {
+        return -1;
+    }
+    *out = (size_t)(value + 0.5);
+    return 0;
+}
+
+// 쉼표로 구분된 개수 목록, "A..B"는 A부터 B까지 10배씩 늘린 개수들로 펼침 (text는 수정됨)
+static int parse_sizes(char *text, BenchConfig *config)
+{
+    size_t num_texts = 0;
+    const char **texts = split_list(text, &num_texts);
+    if (texts == NULL)
+    {
+        return -1;
+    }
+    /* 범위 하나는 최대 20개 (1 ~ 10^19) */
+    config->sizes = (size_t *)malloc((num_texts ? num_texts : 1) * 20 * sizeof(size_t));
+    if (config->sizes == NULL)
+    {
+        free(texts);
+        return -1;
+    }
+    config->num_sizes = 0;
+    for (size_t i = 0; i < num_texts; i++)
+    {
+        char *range = strstr(texts[i], "..");
+        if (range == NULL)
+        {
+            if (parse_size(texts[i], &config->sizes[config->num_sizes++]) != 0)
+            {
+                fprintf(stderr, "invalid size: %s\n", texts[i]);
+                free(texts);
+                return -1;
+            }
+            continue;
+        }
+        size_t low = 0;
+        size_t high = 0;
+        *range = '\0';
+        if (parse_size(texts[i], &low) != 0 || parse_size(range + 2, &high) != 0 || low == 0 || low > high)
+        {
+            fprintf(stderr, "invalid size range: %s..%s\n", texts[i], range + 2);
+            free(texts);
+            return -1;
+        }
+        for (size_t value = low; value <= high; value *= 10)
+        {
+            config->sizes[config->num_sizes++] = value;
+            if (value > SIZE_MAX / 10)
+            {
+                break;
+            }
+        }
+    }
+    free(texts);
+    return 0;
+}
+
+// 쉼표로 구분된 스레드 수 목록, "all"이면 1, 2, 4, ...와 코어 수 (text는 수정됨)
+static int parse_threads(char *text, BenchConfig *config)
+{
+    if (strcmp(text, "all") == 0)
+    {
+        int cpu_count = sort_cpu_count();
+        config->thread_counts = (int *)malloc(34 * sizeof(int));
+        if (config->thread_counts == NULL)
+        {
+            return -1;
+        }
+        config->num_thread_counts = 0;
+        for (int count = 1; count < cpu_count; count *= 2)
+        {
+            config->thread_counts[config->num_thread_counts++] = count;
+        }
+        config->thread_counts[config->num_thread_counts++] = cpu_count;
+        return 0;
+    }
+    size_t num_texts = 0;
+    const char **texts = split_list(text, &num_texts);
+    config->thread_counts = (int *)malloc((num_texts ? num_texts : 1) * sizeof(int));
+    if (texts == NULL || config->thread_counts == NULL)
+    {
+        free(texts);
+        return -1;
+    }
+    for (size_t i = 0; i < num_texts; i++)
+    {
+        config->thread_counts[i] = atoi(texts[i]);
+        if (config->thread_counts[i] <= 0)
+        {
+            fprintf(stderr, "invalid thread count: %s\n", texts[i]);
+            free(texts);
+            return -1;
+        }
+    }
+    config->num_thread_counts = num_texts;
+    free(texts);
+    return 0;
+}
+
+static const BenchAlgorithm *find_algorithm(const char *name)
+{
+    for (size_t i = 0; i < NUM_ALGORITHMS; i++)
+    {
+        if (strcmp(bench_algorithms[i].name, name) == 0)
+        {
+            return &bench_algorithms[i];
+        }
+    }
+    return NULL;
+}
+
+static const BenchType *find_type(const char *name)
+{
+    for (size_t i = 0; i < NUM_TYPES; i++)
+    {
+        if (strcmp(bench_types[i].name, name) == 0)
+        {
+            return &bench_types[i];
+        }
+    }
+    return NULL;
+}
+
+// 옵션 해석, 잘못된 옵션이면 -1, 도움말/목록만 출력했으면 1
+static int parse_args(int argc, char **argv, BenchConfig *config)
+{
+    static char default_algorithms[] = "merge_sort,merge_sort_multi,merge_sort_pp";
+    static char default_types[] = "int,double,student";
+    static char default_distributions[] = "random";
+    char *algorithms = default_algorithms;
+    char *types = default_types;
+    char *distributions = default_distributions;
+    char *sizes = NULL;
+    char *threads = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int uses_value = 1;
+        if (strcmp(arg, "-a") == 0 || strcmp(arg, "--algorithms") == 0) algorithms = (char *)value;
+        else if (strcmp(arg, "-t") == 0 || strcmp(arg, "--types") == 0) types = (char *)value;
+        else if (strcmp(arg, "-n") == 0 || strcmp(arg, "--sizes") == 0) sizes = (char *)value;
+        else if (strcmp(arg, "-d") == 0 || strcmp(arg, "--distributions") == 0) distributions = (char *)value;
+        else if (strcmp(arg, "-w") == 0 || strcmp(arg, "--warmup") == 0) config->warmup = value ? atoi(value) : -1;
+        else if (strcmp(arg, "-r") == 0 || strcmp(arg, "--trials") == 0) config->trials = value ? atoi(value) : 0;
+        else if (strcmp(arg, "-s") == 0 || strcmp(arg, "--seed") == 0) config->seed = value ? strtoull(value, NULL, 10) : 0;
+        else if (strcmp(arg, "--swaps") == 0) config->gen_params.num_swaps = value ? (size_t)strtoull(value, NULL, 10) : 0;
+        else if (strcmp(arg, "--runs") == 0) config->gen_params.num_runs = value ? (size_t)strtoull(value, NULL, 10) : 0;
+        else if (strcmp(arg, "--unique") == 0) config->gen_params.num_unique = value ? (size_t)strtoull(value, NULL, 10) : 0;
+        else if (strcmp(arg, "--zipf") == 0) config->gen_params.zipf_exponent = value ? atof(value) : 0.0;
+        else if (strcmp(arg, "--tail") == 0) config->gen_params.tail_ratio = value ? atof(value) : 0.0;
+        else if (strcmp(arg, "--csv") == 0) config->csv_path = value;
+        else if (strcmp(arg, "--json") == 0) config->json_path = value;
+        else if (strcmp(arg, "--trace") == 0) config->trace_path = value;
+        else if (strcmp(arg, "--threads") == 0) threads = (char *)value;
+        else if (strcmp(arg, "--scaling-csv") == 0) config->scaling_csv_path = value;
+        else if (strcmp(arg, "--baseline") == 0) config->baseline_path = value;
+        else if (strcmp(arg, "--alpha") == 0) config->alpha = value ? atof(value) : 0.0;
+        else if (strcmp(arg, "--tolerance") == 0) config->tolerance = value ? atof(value) / 100.0 : -1.0;
+        else
+        {
+            uses_value = 0;
+            if (strcmp(arg, "--no-verify") == 0) config->verify = 0;
+            else if (strcmp(arg, "--force") == 0) config->force = 1;
+            else if (strcmp(arg, "--perf") == 0) config->use_perf = 1;
+            else if (strcmp(arg, "--memory") == 0) config->track_memory = 1;
+            else if (strcmp(arg, "--weak") == 0) config->is_weak = 1;
+            else if (strcmp(arg, "-l") == 0 || strcmp(arg, "--list") == 0) { print_list(); return 1; }
+            else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) { print_usage(argv[0]); return 1; }
+            else
+            {
+                fprintf(stderr, "unknown option: %s\n", arg);
+                return -1;
+            }
+        }
+        if (uses_value)
+        {
+            if (value == NULL)
+            {
+                fprintf(stderr, "missing value for %s\n", arg);
+                return -1;
+            }
+            i++;
+        }
+    }
+    if (config->warmup < 0 || config->trials <= 0)
+    {
+        fprintf(stderr, "warmup must be >= 0 and trials > 0\n");
+        return -1;
+    }
+    if (config->alpha <= 0.0 || config->alpha >= 1.0 || config->tolerance < 0.0)
+    {
+        fprintf(stderr, "alpha must be in (0, 1) and tolerance >= 0\n");
+        return -1;
+    }
+
+    config->algorithms = split_list(algorithms, &config->num_algorithms);
+    config->types = split_list(types, &config->num_types);
+    if (strcmp(distributions, "all") == 0)
+    {
+        static const char *all_distributions[GEN_NUM_DISTRIBUTIONS];
+        for (int i = 0; i < GEN_NUM_DISTRIBUTIONS; i++)
+        {
+            all_distributions[i] = gen_distribution_name((GenDistribution)i);
+        }
+        config->distributions = (const char **)malloc(sizeof(all_distributions));
+        if (config->distributions != NULL)
+        {
+            memcpy(config->distributions, all_distributions, sizeof(all_distributions));
+            config->num_distributions = GEN_NUM_DISTRIBUTIONS;
+        }
+    }
+    else
+    {
+        config->distributions = split_list(distributions, &config->num_distributions);
+    }
+    if (config->algorithms == NULL || config->types == NULL || config->distributions == NULL)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < config->num_algorithms; i++)
+    {
+        if (find_algorithm(config->algorithms[i]) == NULL)
+        {
+            fprintf(stderr, "unknown algorithm: %s (see --list)\n", config->algorithms[i]);
+            return -1;
+        }
+    }
+    for (size_t i = 0; i < config->num_types; i++)
+    {
+        if (find_type(config->types[i]) == NULL)
+        {
+            fprintf(stderr, "unknown type: %s (see --list)\n", config->types[i]);
+            return -1;
+        }
+    }
+    for (size_t i = 0; i < config->num_distributions; i++)
+    {
+        if (gen_find_distribution(config->distributions[i]) < 0)
+        {
+            fprintf(stderr, "unknown distribution: %s (see --list)\n", config->distributions[i]);
+            return -1;
+        }
+    }
+
+    if (threads == NULL)
+    {
+        config->thread_counts = (int *)calloc(1, sizeof(int));
+        config->num_thread_counts = 1;
+        if (config->thread_counts == NULL)
+        {
+            return -1;
+        }
+        if (config->is_weak || config->scaling_csv_path != NULL)
+        {
+            fprintf(stderr, "--weak and --scaling-csv need --threads\n");
+            return -1;
+        }
+    }
+    else if (parse_threads(threads, config) != 0)
+    {
+        return -1;
+    }
+
+    if (sizes == NULL)
+    {
+        config->sizes = (size_t *)malloc(sizeof(size_t));
+        if (config->sizes == NULL)
+        {
+            return -1;
+        }
+        config->sizes[0] = 1000000;
+        config->num_sizes = 1;
+        return 0;
+    }
+    return parse_sizes(sizes, config);
+}
+
+// ==========================================
+// 6. 실행
+// ==========================================
+
+int main(int argc, char **argv)
+{
+    BenchConfig config;
+    memset(&config, 0, sizeof(config));
+    config.warmup = 1;
+    config.trials = 5;
+    config.seed = 12345;
+    config.verify = 1;
+    config.alpha = 0.05;
+    config.tolerance = 0.05;
+
+    int parsed = parse_args(argc, argv, &config);
+    if (parsed != 0)
+    {
+        return (parsed > 0) ? 0 : 2;
+    }
+
+    size_t max_results = config.num_algorithms * config.num_types * config.num_distributions * config.num_sizes * config.num_thread_counts;
+    BenchResult *results = (BenchResult *)calloc(max_results ? max_results : 1, sizeof(BenchResult));
+    double *times = (double *)malloc((max_results ? max_results : 1) * (size_t)config.trials * sizeof(double));
+    if (results == NULL || times == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    size_t num_results = 0;
+    int has_failure = 0;
+
+    PerfCounters perf_counters;
+    if (config.use_perf)
+    {
+        if (perf_counters_open(&perf_counters) == 0)
+        {
+            config.perf = &perf_counters;
+        }
+        else
+        {
+            fprintf(stderr, "hardware counters unavailable (not Linux, or blocked by perf_event_paranoid / container), continuing without --perf\n");
+        }
+    }
+
+    if (config.track_memory)
+    {
+        mem_tracker_install();
+    }
+
+    printf("cpu count: %d, warmup: %d, trials: %d, seed: %llu\n\n", sort_cpu_count(), config.warmup, config.trials, (unsigned long long)config.seed);
+    print_header();
+
+    /* 스레드 수는 측정하는 동안에만 고정하고, 데이터 생성과 --threads 없는 측정은 원래 설정(설정 파일 등)을 따름 */
+    SortTuning original_tuning;
+    sort_get_tuning(&original_tuning);
+    sort_trace_reset();
+
+    for (size_t t = 0; t < config.num_types; t++)
+    {
+        const BenchType *type = find_type(config.types[t]);
+        for (size_t s = 0; s < config.num_sizes; s++)
+        {
+            for (size_t c = 0; c < config.num_thread_counts; c++)
+            {
+                int num_threads = config.thread_counts[c];
+                size_t n = config.is_weak ? config.sizes[s] * (size_t)num_threads : config.sizes[s];
+                size_t bytes = n * type->size_of_element;
+                void *source = malloc(bytes ? bytes : 1);
+                void *work = malloc(bytes ? bytes : 1);
+                for (size_t d = 0; d < config.num_distributions; d++)
+                {
+                    GenDistribution distribution = (GenDistribution)gen_find_distribution(config.distributions[d]);
+                    int is_generated = (source != NULL && work != NULL && generate_data(source, n, type->gen_type, distribution, &config.gen_params, config.seed) == 0);
+                    for (size_t a = 0; a < config.num_algorithms; a++)
+                    {
+                        const BenchAlgorithm *algorithm = find_algorithm(config.algorithms[a]);
+                        BenchResult *result = &results[num_results++];
+                        result->algorithm = algorithm->name;
+                        result->type = type->name;
+                        result->distribution = config.distributions[d];
+                        result->num_of_elements = n;
+                        result->sweep_size = config.sizes[s];
+                        result->num_threads = num_threads;
+                        result->times = times + (num_results - 1) * (size_t)config.trials;
+                        if (!is_generated)
+                        {
+                            result->status = "OOM";
+                        }
+                        else if (algorithm->max_elements != 0 && n > algorithm->max_elements && !config.force)
+                        {
+                            result->status = "SKIP";
+                        }
+                        else
+                        {
+                            result->trials = config.trials;
+                            sort_set_thread_count((num_threads > 0) ? num_threads : original_tuning.num_threads);
+                            measure(&config, algorithm, type, source, work, n, result);
+                            sort_set_thread_count(original_tuning.num_threads);
+                            if (strcmp(result->status, "OK") != 0)
+                            {
+                                result->trials = 0;
+                                has_failure = 1;
+                            }
+                        }
+                        has_failure |= (strcmp(result->status, "OOM") == 0);
+                        print_result(result);
+                    }
+                }
+                free(source);
+                free(work);
+            }
+        }
+    }
+
+    if (config.csv_path != NULL && write_csv(config.csv_path, results, num_results) != 0)
+    {
+        fprintf(stderr, "failed to write %s\n", config.csv_path);
+        has_failure = 1;
+    }
+    if (config.json_path != NULL && write_json(config.json_path, results, num_results) != 0)
+    {
+        fprintf(stderr, "failed to write %s\n", config.json_path);
+        has_failure = 1;
+    }
+
+    if (config.trace_path != NULL && sort_trace_dump(config.trace_path) != 0)
+    {
+        fprintf(stderr, "failed to write %s (the library must be built with -DSORT_TRACE)\n", config.trace_path);
+        has_failure = 1;
+    }
+
+    if (config.thread_counts[0] > 0 && report_scaling(&config, results, num_results) != 0)
+    {
+        fprintf(stderr, "failed to write %s\n", config.scaling_csv_path);
+        has_failure = 1;
+    }
+
+    int num_regressions = 0;
+    if (config.baseline_path != NULL)
+    {
+        num_regressions = compare_with_baseline(&config, results, num_results);
+        if (num_regressions < 0)
+        {
+            has_failure = 1;
+        }
+        else if (num_regressions > 0)
+        {
+            printf("\n%d regression(s) against %s\n", num_regressions, config.baseline_path);
+        }
+    }
+
+    if (config.perf != NULL)
+    {
+        perf_counters_close(config.perf);
+    }
+    if (config.track_memory)
+    {
+        mem_tracker_uninstall();
+    }
+    free(times);
+    free(results);
+    free(config.algorithms);
+    free(config.types);
+    free(config.distributions);
+    free(config.sizes);
+    free(config.thread_counts);
+    return has_failure ? 1 : (num_regressions > 0) ? 3 : 0;
+}
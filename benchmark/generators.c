@@ -0,0 +1,299 @@
+/**
+ * @file generators.c
+ * @brief 벤치마크 입력 데이터 생성기 구현부
+ *
+ * 각 원소의 값을 먼저 [0, 2^53) 범위의 정수 v로 정한 뒤 자료형에 맞게 순서를 유지하며 변환
+ * (int는 상위 32비트, double은 v / 2^53, Student는 성적순(점수 내림차순)이 정렬된 순서가 되도록 score = (1 - v / 2^53) * 100)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "generators.h"
+#include "../library/sort_internal.h"
+
+/* 청크 하나의 원소 수, 청크마다 시드가 정해지므로 결과는 스레드 수와 무관 */
+#define GEN_CHUNK ((size_t)1 << 16)
+#define GEN_VALUE_RANGE 9007199254740992.0 // 2^53
+
+#define DEFAULT_NUM_RUNS 16
+#define DEFAULT_NUM_UNIQUE 16
+#define DEFAULT_ZIPF_UNIQUE 65536
+#define DEFAULT_ZIPF_EXPONENT 1.0
+#define DEFAULT_TAIL_RATIO 0.01
+
+static const char *distribution_names[GEN_NUM_DISTRIBUTIONS] = {
+    "random", "sorted", "reverse", "nearly_sorted", "sawtooth",
+    "organ_pipe", "few_unique", "zipf", "all_equal", "appended_tail"
+};
+
+/* 작업 스레드 인자 구조체 */
+typedef struct GenArgStruct
+{
+    void *arr;
+    size_t num_of_elements;
+    GenType type;
+    GenDistribution distribution;
+    const GenParams *params;
+    const double *zipf_cdf;     // GEN_ZIPF일 때 누적 확률표 (params->num_unique개)
+    size_t head_count;          // GEN_APPENDED_TAIL에서 정렬된 앞부분의 원소 수
+    uint64_t seed;
+    size_t first_chunk;
+    size_t last_chunk;          // 이 청크 직전까지 처리
+} GenArg;
+
+static SORT_THREAD_PROC generate_chunks(void *arg);
+static uint64_t value_at(const GenArg *arg, size_t index, uint64_t *state);
+static void store_value(void *arr, GenType type, size_t index, uint64_t value);
+static uint64_t splitmix64(uint64_t x);
+static uint64_t xorshift64(uint64_t *state);
+
+/* [공개 함수] 분포 이름 */
+const char *gen_distribution_name(GenDistribution distribution)
+{
+    if ((unsigned)distribution >= GEN_NUM_DISTRIBUTIONS)
+    {
+        return "unknown";
+    }
+    return distribution_names[distribution];
+}
+
+/* [공개 함수] 이름으로 분포 찾기 */
+int gen_find_distribution(const char *name)
+{
+    for (int i = 0; i < GEN_NUM_DISTRIBUTIONS; i++)
+    {
+        if (strcmp(distribution_names[i], name) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* [공개 함수] 원소 크기 */
+size_t gen_type_size(GenType type)
+{
+    switch (type)
+    {
+    case GEN_TYPE_INT:
+        return sizeof(int);
+    case GEN_TYPE_DOUBLE:
+        return sizeof(double);
+    default:
+        return sizeof(Student);
+    }
+}
+
+/* [공개 함수] 멀티 스레드 데이터 생성 */
+int generate_data(void *arr, size_t num_of_elements, GenType type, GenDistribution distribution, const GenParams *params, uint64_t seed)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements == 0))
+    {
+        return 0;
+    }
+
+    /* 0인 설정을 기본값으로 채움 */
+    GenParams resolved;
+    memset(&resolved, 0, sizeof(resolved));
+    if (params != NULL)
+    {
+        resolved = *params;
+    }
+    if (resolved.num_swaps == 0)
+    {
+        resolved.num_swaps = (num_of_elements / 100 > 0) ? num_of_elements / 100 : 1;
+    }
+    if (resolved.num_runs == 0)
+    {
+        resolved.num_runs = DEFAULT_NUM_RUNS;
+    }
+    if (resolved.num_unique == 0)
+    {
+        resolved.num_unique = (distribution == GEN_ZIPF) ? DEFAULT_ZIPF_UNIQUE : DEFAULT_NUM_UNIQUE;
+    }
+    if (resolved.zipf_exponent <= 0.0)
+    {
+        resolved.zipf_exponent = DEFAULT_ZIPF_EXPONENT;
+    }
+    if (resolved.tail_ratio <= 0.0 || resolved.tail_ratio > 1.0)
+    {
+        resolved.tail_ratio = DEFAULT_TAIL_RATIO;
+    }
+
+    /* Zipf 분포는 누적 확률표를 만든 뒤 이진 탐색으로 순위를 뽑음 */
+    double *zipf_cdf = NULL;
+    if (distribution == GEN_ZIPF)
+    {
+        zipf_cdf = (double *)malloc(resolved.num_unique * sizeof(double));
+        if (SORT_UNLIKELY(zipf_cdf == NULL))
+        {
+            return -1;
+        }
+        double sum = 0.0;
+        for (size_t k = 0; k < resolved.num_unique; k++)
+        {
+            sum += 1.0 / pow((double)(k + 1), resolved.zipf_exponent);
+            zipf_cdf[k] = sum;
+        }
+        for (size_t k = 0; k < resolved.num_unique; k++)
+        {
+            zipf_cdf[k] /= sum;
+        }
+    }
+
+    size_t num_chunks = (num_of_elements + GEN_CHUNK - 1) / GEN_CHUNK;
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_chunks < (size_t)cpu_count) ? (int)num_chunks : cpu_count;
+    GenArg *args = (GenArg *)malloc((size_t)num_workers * sizeof(GenArg));
+    if (SORT_UNLIKELY(args == NULL))
+    {
+        free(zipf_cdf);
+        return -1;
+    }
+    size_t tail_count = (size_t)((double)num_of_elements * resolved.tail_ratio);
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].arr = arr;
+        args[t].num_of_elements = num_of_elements;
+        args[t].type = type;
+        args[t].distribution = distribution;
+        args[t].params = &resolved;
+        args[t].zipf_cdf = zipf_cdf;
+        args[t].head_count = num_of_elements - tail_count;
+        args[t].seed = seed;
+        args[t].first_chunk = num_chunks * (size_t)t / (size_t)num_workers;
+        args[t].last_chunk = num_chunks * (size_t)(t + 1) / (size_t)num_workers;
+    }
+    sort_run_workers(generate_chunks, args, sizeof(GenArg), num_workers);
+    free(args);
+    free(zipf_cdf);
+
+    /* 거의 정렬된 배열: 정렬된 상태에서 무작위 위치 교환 (교환 횟수가 적으므로 싱글 스레드) */
+    if (distribution == GEN_NEARLY_SORTED && num_of_elements > 1)
+    {
+        size_t size_of_element = gen_type_size(type);
+        uint64_t state = splitmix64(seed ^ 0x5DEECE66DULL);
+        for (size_t s = 0; s < resolved.num_swaps; s++)
+        {
+            size_t a = (size_t)(xorshift64(&state) % num_of_elements);
+            size_t b = (size_t)(xorshift64(&state) % num_of_elements);
+            generic_swap((char *)arr + a * size_of_element, (char *)arr + b * size_of_element, size_of_element);
+        }
+    }
+    return 0;
+}
+
+static SORT_THREAD_PROC generate_chunks(void *arg)
+{
+    GenArg *arg_ptr = (GenArg *)arg;
+    for (size_t chunk = arg_ptr->first_chunk; chunk < arg_ptr->last_chunk; chunk++)
+    {
+        uint64_t state = splitmix64(splitmix64(arg_ptr->seed) + chunk);
+        size_t begin = chunk * GEN_CHUNK;
+        size_t end = (begin + GEN_CHUNK < arg_ptr->num_of_elements) ? begin + GEN_CHUNK : arg_ptr->num_of_elements;
+        for (size_t i = begin; i < end; i++)
+        {
+            store_value(arg_ptr->arr, arg_ptr->type, i, value_at(arg_ptr, i, &state));
+        }
+    }
+    return 0;
+}
+
+/* 분포에 따른 index번째 원소의 값 (0 ~ 2^53 - 1) */
+static uint64_t value_at(const GenArg *arg, size_t index, uint64_t *state)
+{
+    size_t n = arg->num_of_elements;
+    const GenParams *params = arg->params;
+    switch (arg->distribution)
+    {
+    case GEN_SORTED:
+    case GEN_NEARLY_SORTED:
+        return (uint64_t)((double)index * (GEN_VALUE_RANGE / (double)n));
+    case GEN_REVERSE:
+        return (uint64_t)((double)(n - 1 - index) * (GEN_VALUE_RANGE / (double)n));
+    case GEN_SAWTOOTH:
+    {
+        size_t run_length = (n + params->num_runs - 1) / params->num_runs;
+        return (uint64_t)((double)(index % run_length) * (GEN_VALUE_RANGE / (double)run_length));
+    }
+    case GEN_ORGAN_PIPE:
+    {
+        size_t distance = (index < n - 1 - index) ? index : n - 1 - index;
+        return (uint64_t)((double)distance * (GEN_VALUE_RANGE / (double)(n / 2 + 1)));
+    }
+    case GEN_FEW_UNIQUE:
+        return (uint64_t)((double)(xorshift64(state) % params->num_unique) * (GEN_VALUE_RANGE / (double)params->num_unique));
+    case GEN_ZIPF:
+    {
+        double u = (double)(xorshift64(state) >> 11) / GEN_VALUE_RANGE;
+        size_t low = 0;
+        size_t high = params->num_unique - 1;
+        while (low < high)
+        {
+            size_t middle = low + (high - low) / 2;
+            if (arg->zipf_cdf[middle] < u)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return (uint64_t)((double)low * (GEN_VALUE_RANGE / (double)params->num_unique));
+    }
+    case GEN_ALL_EQUAL:
+        return (uint64_t)1 << 52;
+    case GEN_APPENDED_TAIL:
+        if (index < arg->head_count)
+        {
+            return (uint64_t)((double)index * (GEN_VALUE_RANGE / (double)arg->head_count));
+        }
+        return xorshift64(state) >> 11;
+    case GEN_RANDOM:
+    default:
+        return xorshift64(state) >> 11;
+    }
+}
+
+/* 값의 순서를 유지하며 자료형에 맞게 저장 */
+static void store_value(void *arr, GenType type, size_t index, uint64_t value)
+{
+    switch (type)
+    {
+    case GEN_TYPE_INT:
+        ((int *)arr)[index] = (int)((int64_t)(value >> 21) - 2147483648LL);
+        break;
+    case GEN_TYPE_DOUBLE:
+        ((double *)arr)[index] = (double)value / GEN_VALUE_RANGE;
+        break;
+    default:
+    {
+        Student *student = (Student *)arr + index;
+        memset(student, 0, sizeof(Student));
+        student->id = (int)index;
+        student->name[0] = 'S';
+        student->score = 100.0 - (double)value * (100.0 / GEN_VALUE_RANGE);
+        break;
+    }
+    }
+}
+
+static uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x ? x : 1; // xorshift 상태는 0이 되면 안 됨
+}
+
+static uint64_t xorshift64(uint64_t *state)
+{
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
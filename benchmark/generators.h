@@ -0,0 +1,86 @@
+/**
+ * @file generators.h
+ *
+ * @brief 벤치마크 입력 데이터 생성기
+ *
+ * 무작위, 정렬됨, 역순, 거의 정렬됨, 톱니, 산 모양, 적은 종류의 값, Zipf 분포, 모두 같은 값, 정렬된 배열 뒤에 무작위 꼬리
+ * 모양의 데이터를 int, double, Student 형식으로 생성
+ * 청크마다 시드를 따로 정하므로 스레드 수와 관계없이 같은 시드면 항상 같은 데이터가 만들어짐
+ *
+ * */
+
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* 구조체 정렬 측정용 원소 (48 바이트) */
+typedef struct
+{
+    int id;
+    char name[32];
+    double score;
+} Student;
+
+typedef enum GenTypeEnum
+{
+    GEN_TYPE_INT,
+    GEN_TYPE_DOUBLE,
+    GEN_TYPE_STUDENT    // 점수 내림차순, 같은 점수는 id 오름차순이 정렬된 순서 (id는 위치)
+} GenType;
+
+typedef enum GenDistributionEnum
+{
+    GEN_RANDOM,
+    GEN_SORTED,
+    GEN_REVERSE,
+    GEN_NEARLY_SORTED,  // 정렬된 배열에서 num_swaps번 무작위 위치 교환
+    GEN_SAWTOOTH,       // num_runs개의 오름차순 구간이 반복
+    GEN_ORGAN_PIPE,     // 앞 절반은 오름차순, 뒤 절반은 내림차순
+    GEN_FEW_UNIQUE,     // num_unique종류의 값이 고르게 섞임
+    GEN_ZIPF,           // 작은 값일수록 자주 나오는 Zipf 분포 (지수 zipf_exponent)
+    GEN_ALL_EQUAL,
+    GEN_APPENDED_TAIL,  // 정렬된 배열 뒤에 전체의 tail_ratio만큼 무작위 원소를 덧붙임
+    GEN_NUM_DISTRIBUTIONS
+} GenDistribution;
+
+/* 분포의 세부 설정, 0인 값은 기본값을 사용 */
+typedef struct GenParamsStruct
+{
+    size_t num_swaps;       // GEN_NEARLY_SORTED (기본: n / 100, 최소 1)
+    size_t num_runs;        // GEN_SAWTOOTH (기본 16)
+    size_t num_unique;      // GEN_FEW_UNIQUE, GEN_ZIPF의 값 종류 수 (기본 16, Zipf는 65536)
+    double zipf_exponent;   // GEN_ZIPF (기본 1.0)
+    double tail_ratio;      // GEN_APPENDED_TAIL (기본 0.01)
+} GenParams;
+
+/**
+ * @brief 분포 이름 문자열 (예: "nearly_sorted")
+ */
+const char *gen_distribution_name(GenDistribution distribution);
+
+/**
+ * @brief 이름으로 분포 찾기
+ *
+ * @return 해당하는 분포, 없으면 -1을 반환
+ *
+ */
+int gen_find_distribution(const char *name);
+
+/**
+ * @brief 원소 크기 (sizeof(int), sizeof(double), sizeof(Student))
+ */
+size_t gen_type_size(GenType type);
+
+/**
+ * @brief 멀티 스레드 데이터 생성
+ *
+ * @param params NULL이면 모든 설정에 기본값을 사용
+ *
+ * @return 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int generate_data(void *arr, size_t num_of_elements, GenType type, GenDistribution distribution, const GenParams *params, uint64_t seed);
+
+#endif // GENERATORS_H
@@ -0,0 +1,198 @@
+/**
+ * @file mem_usage.c
+ * @brief 벤치마크용 메모리 사용량 측정 구현부
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_usage.h"
+#include "../library/sorting.h"
+#include "../library/sort_internal.h" // 원자적 카운터
+
+#if defined(_WIN32)
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+/* 블록 앞에 크기를 저장하는 머리 (malloc과 같은 16바이트 정렬 유지) */
+#define TRACK_HEADER 16
+
+static volatile size_t current_bytes;
+static volatile size_t peak_bytes;
+
+// ==========================================
+// 1. 라이브러리 할당 추적
+// ==========================================
+
+static void add_bytes(size_t bytes)
+{
+    size_t now = sort_atomic_fetch_add(&current_bytes, bytes) + bytes;
+    size_t peak = sort_atomic_fetch_add(&peak_bytes, 0);
+    while (now > peak && !sort_atomic_compare_exchange(&peak_bytes, peak, now))
+    {
+        peak = sort_atomic_fetch_add(&peak_bytes, 0);
+    }
+}
+
+static void *track_malloc(size_t bytes, void *user_data)
+{
+    (void)user_data;
+    char *block = (char *)malloc(bytes + TRACK_HEADER);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    *(size_t *)block = bytes;
+    add_bytes(bytes);
+    return block + TRACK_HEADER;
+}
+
+static void track_free(void *ptr, void *user_data)
+{
+    (void)user_data;
+    if (ptr == NULL)
+    {
+        return;
+    }
+    char *block = (char *)ptr - TRACK_HEADER;
+    sort_atomic_fetch_add(&current_bytes, (size_t)0 - *(size_t *)block);
+    free(block);
+}
+
+static void *track_realloc(void *ptr, size_t bytes, void *user_data)
+{
+    if (ptr == NULL)
+    {
+        return track_malloc(bytes, user_data);
+    }
+    char *block = (char *)ptr - TRACK_HEADER;
+    size_t old_bytes = *(size_t *)block;
+    char *new_block = (char *)realloc(block, bytes + TRACK_HEADER);
+    if (new_block == NULL)
+    {
+        return NULL;
+    }
+    *(size_t *)new_block = bytes;
+    sort_atomic_fetch_add(&current_bytes, (size_t)0 - old_bytes);
+    add_bytes(bytes);
+    return new_block + TRACK_HEADER;
+}
+
+/* [공개 함수] 할당 추적 시작 */
+void mem_tracker_install(void)
+{
+#if defined(__GLIBC__)
+    /* glibc는 큰 블록을 해제하면 mmap 기준을 올려 다음 할당부터 힙에 남은 메모리를 재사용하므로,
+       측정마다 작업 공간이 새로 RSS를 늘리도록 기준을 기본값(128 KiB)에 고정 */
+    mallopt(M_MMAP_THRESHOLD, 128 * 1024);
+#endif
+    SortAllocator allocator = {track_malloc, track_realloc, track_free, NULL};
+    sort_set_allocator(&allocator);
+}
+
+/* [공개 함수] 할당 추적 종료 */
+void mem_tracker_uninstall(void)
+{
+    sort_set_allocator(NULL);
+}
+
+/* [공개 함수] 최대 사용량 초기화 */
+void mem_tracker_reset(void)
+{
+    peak_bytes = current_bytes;
+}
+
+/* [공개 함수] 최대 사용량 */
+size_t mem_tracker_peak(void)
+{
+    return sort_atomic_fetch_add(&peak_bytes, 0);
+}
+
+// ==========================================
+// 2. 프로세스 메모리
+// ==========================================
+
+#if defined(_WIN32)
+
+/* [공개 함수] 최대 RSS 초기화 (윈도우는 지원하지 않음) */
+int mem_usage_reset_peak(void)
+{
+    return -1;
+}
+
+/* [공개 함수] 메모리 사용량 읽기 */
+void mem_usage_read(MemUsage *out)
+{
+    memset(out, 0, sizeof(MemUsage));
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        out->peak_rss = counters.PeakWorkingSetSize;
+        out->current_rss = counters.WorkingSetSize;
+        out->minor_faults = counters.PageFaultCount; // 윈도우는 두 종류를 구분하지 않음
+    }
+}
+
+#else
+
+/* [공개 함수] 최대 RSS 초기화 (리눅스 4.0 이상) */
+int mem_usage_reset_peak(void)
+{
+#if defined(__linux__)
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    int is_written = (fputs("5", file) >= 0);
+    return (fclose(file) == 0 && is_written) ? 0 : -1;
+#else
+    return -1;
+#endif
+}
+
+/* [공개 함수] 메모리 사용량 읽기 */
+void mem_usage_read(MemUsage *out)
+{
+    memset(out, 0, sizeof(MemUsage));
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        out->minor_faults = (unsigned long long)usage.ru_minflt;
+        out->major_faults = (unsigned long long)usage.ru_majflt;
+#if defined(__APPLE__)
+        out->peak_rss = (size_t)usage.ru_maxrss; // macOS는 바이트 단위
+#else
+        out->peak_rss = (size_t)usage.ru_maxrss * 1024;
+#endif
+    }
+#if defined(__linux__)
+    /* ru_maxrss는 초기화되지 않으므로 clear_refs가 반영되는 VmHWM을 우선 사용 */
+    FILE *file = fopen("/proc/self/status", "r");
+    if (file == NULL)
+    {
+        return;
+    }
+    char line[256];
+    unsigned long long kib;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (sscanf(line, "VmHWM: %llu kB", &kib) == 1)
+        {
+            out->peak_rss = (size_t)kib * 1024;
+        }
+        else if (sscanf(line, "VmRSS: %llu kB", &kib) == 1)
+        {
+            out->current_rss = (size_t)kib * 1024;
+        }
+    }
+    fclose(file);
+#endif
+}
+
+#endif
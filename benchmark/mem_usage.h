@@ -0,0 +1,53 @@
+/**
+ * @file mem_usage.h
+ *
+ * @brief 벤치마크용 메모리 사용량 측정
+ *
+ * 프로세스의 상주 메모리(RSS)와 페이지 폴트 수를 운영체제에서 읽고,
+ * sort_set_allocator로 라이브러리의 작업 공간 할당을 감싸 동시에 사용 중인 최대 바이트 수를 셈
+ * 리눅스는 측정마다 최대 RSS를 초기화할 수 있어(/proc/self/clear_refs) 정렬 한 번이 늘린 RSS를 구할 수 있고,
+ * 그 외 운영체제에서는 프로세스 전체의 최대 RSS만 알 수 있음
+ *
+ * */
+
+#ifndef MEM_USAGE_H
+#define MEM_USAGE_H
+
+#include <stddef.h>
+
+typedef struct MemUsageStruct
+{
+    size_t peak_rss;                    // 최대 상주 메모리 (바이트, 알 수 없으면 0)
+    size_t current_rss;                 // 현재 상주 메모리 (바이트, 알 수 없으면 0)
+    unsigned long long minor_faults;    // 프로세스 시작 후 누적 페이지 폴트 수 (디스크 읽기 없음)
+    unsigned long long major_faults;    // 디스크 읽기가 필요했던 페이지 폴트 수
+} MemUsage;
+
+/**
+ * @brief 최대 RSS를 현재 RSS로 초기화
+ *
+ * @return 초기화할 수 없는 환경이면 -1을, 성공하면 0을 반환
+ *
+ */
+int mem_usage_reset_peak(void);
+
+void mem_usage_read(MemUsage *out);
+
+/**
+ * @brief 라이브러리 작업 공간 할당 추적 시작 (sort_set_allocator로 할당 함수를 교체)
+ */
+void mem_tracker_install(void);
+
+void mem_tracker_uninstall(void);
+
+/**
+ * @brief 최대 동시 사용량을 현재 사용량으로 초기화
+ */
+void mem_tracker_reset(void);
+
+/**
+ * @brief 마지막 초기화 이후 라이브러리가 동시에 사용한 작업 공간의 최대 바이트 수
+ */
+size_t mem_tracker_peak(void);
+
+#endif // MEM_USAGE_H
@@ -0,0 +1,152 @@
+/**
+ * @file perf_counters.c
+ * @brief 벤치마크용 하드웨어 성능 카운터 구현부
+ */
+
+#include <string.h>
+#include "perf_counters.h"
+
+#if defined(__linux__)
+    #include <unistd.h>
+    #include <stdint.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+#endif
+
+static const char *event_names[PERF_NUM_EVENTS] = {
+    "cycles", "instructions", "branch_misses", "llc_misses", "dtlb_misses"
+};
+
+/* [공개 함수] 항목 이름 */
+const char *perf_event_name(PerfEvent event)
+{
+    if ((unsigned)event >= PERF_NUM_EVENTS)
+    {
+        return "unknown";
+    }
+    return event_names[event];
+}
+
+#if defined(__linux__)
+
+/* 다중화된 카운터를 전체 시간으로 환산하기 위해 실행 시간도 함께 읽음 */
+typedef struct PerfReadFormatStruct
+{
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+} PerfReadFormat;
+
+static int open_event(uint32_t type, uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;           // 측정 중 생성된 스레드 포함
+    attr.exclude_kernel = 1;    // perf_event_paranoid가 2여도 열 수 있도록 사용자 영역만 측정
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/* [공개 함수] 카운터 열기 */
+int perf_counters_open(PerfCounters *counters)
+{
+    counters->fds[PERF_EVENT_CYCLES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    counters->fds[PERF_EVENT_INSTRUCTIONS] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    counters->fds[PERF_EVENT_BRANCH_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    counters->fds[PERF_EVENT_LLC_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    counters->fds[PERF_EVENT_DTLB_MISSES] = open_event(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    int num_opened = 0;
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        num_opened += (counters->fds[i] >= 0);
+    }
+    return (num_opened > 0) ? 0 : -1;
+}
+
+/* [공개 함수] 측정 시작 */
+void perf_counters_start(PerfCounters *counters)
+{
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        if (counters->fds[i] >= 0)
+        {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counters->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+/* [공개 함수] 측정 종료 */
+void perf_counters_stop(PerfCounters *counters, PerfSample *out)
+{
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        if (counters->fds[i] >= 0)
+        {
+            ioctl(counters->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        PerfReadFormat data;
+        out->values[i] = 0;
+        out->is_valid[i] = 0;
+        if (counters->fds[i] < 0 || read(counters->fds[i], &data, sizeof(data)) != (ssize_t)sizeof(data) || data.time_running == 0)
+        {
+            continue;
+        }
+        double scale = (data.time_running < data.time_enabled) ? (double)data.time_enabled / (double)data.time_running : 1.0;
+        out->values[i] = (unsigned long long)((double)data.value * scale);
+        out->is_valid[i] = 1;
+    }
+}
+
+/* [공개 함수] 카운터 닫기 */
+void perf_counters_close(PerfCounters *counters)
+{
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        if (counters->fds[i] >= 0)
+        {
+            close(counters->fds[i]);
+            counters->fds[i] = -1;
+        }
+    }
+}
+
+#else
+
+/* 리눅스가 아니면 항상 사용 불가 */
+int perf_counters_open(PerfCounters *counters)
+{
+    for (int i = 0; i < PERF_NUM_EVENTS; i++)
+    {
+        counters->fds[i] = -1;
+    }
+    return -1;
+}
+
+void perf_counters_start(PerfCounters *counters)
+{
+    (void)counters;
+}
+
+void perf_counters_stop(PerfCounters *counters, PerfSample *out)
+{
+    (void)counters;
+    memset(out, 0, sizeof(PerfSample));
+}
+
+void perf_counters_close(PerfCounters *counters)
+{
+    (void)counters;
+}
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file perf_counters.h
+ *
+ * @brief 벤치마크용 하드웨어 성능 카운터 (리눅스 perf_event_open)
+ *
+ * 사이클, 명령어, 분기 예측 실패, LLC 미스, dTLB 미스를 측정 구간 동안 센다
+ * 측정 중 생성된 스레드도 함께 세며 (inherit), 종료된 스레드의 값은 부모에 합산됨
+ * 리눅스가 아니거나 권한이 없는 환경(컨테이너, perf_event_paranoid 제한 등)에서는 열 수 있는 카운터만 사용하고,
+ * 하나도 열 수 없으면 사용 불가로 표시됨
+ *
+ * */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+typedef enum PerfEventEnum
+{
+    PERF_EVENT_CYCLES,
+    PERF_EVENT_INSTRUCTIONS,
+    PERF_EVENT_BRANCH_MISSES,
+    PERF_EVENT_LLC_MISSES,
+    PERF_EVENT_DTLB_MISSES,
+    PERF_NUM_EVENTS
+} PerfEvent;
+
+typedef struct PerfCountersStruct
+{
+    int fds[PERF_NUM_EVENTS];   // 열지 못한 카운터는 -1
+} PerfCounters;
+
+/* 측정 결과, is_valid가 0인 항목은 측정하지 못한 값 */
+typedef struct PerfSampleStruct
+{
+    unsigned long long values[PERF_NUM_EVENTS];
+    int is_valid[PERF_NUM_EVENTS];
+} PerfSample;
+
+/**
+ * @brief 카운터 열기 (측정은 시작하지 않음)
+ *
+ * @return 하나 이상 열었으면 0을, 하나도 열지 못했으면 -1을 반환
+ *
+ */
+int perf_counters_open(PerfCounters *counters);
+
+/**
+ * @brief 카운터를 0으로 초기화하고 측정 시작
+ */
+void perf_counters_start(PerfCounters *counters);
+
+/**
+ * @brief 측정을 멈추고 값을 읽음 (다중화로 일부 시간만 측정된 카운터는 전체 시간으로 환산)
+ */
+void perf_counters_stop(PerfCounters *counters, PerfSample *out);
+
+void perf_counters_close(PerfCounters *counters);
+
+/**
+ * @brief 항목 이름 (예: "llc_misses")
+ */
+const char *perf_event_name(PerfEvent event);
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,343 @@
+/**
+ * @file auto_sort.c
+ * @brief 입력을 표본 조사하여 알맞은 정렬 엔진을 고르는 자동 정렬 구현부
+ *
+ * 크기, 원소 크기, 표본의 정렬된 정도(이웃 원소 쌍의 순서)와 중복 비율, 사용 가능한 코어 수를 보고 엔진을 선택
+ * 삽입 정렬과 중복 입력의 기준은 튜닝 값(auto_insertion_limit, auto_few_unique_permille)으로 sort_calibrate가 측정함
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 표본 이웃 쌍 중 역순인 쌍이 이 비율 이하이면 전체를 훑어 오름차순 구간 수를 셈 */
+#define AUTO_NEARLY_SORTED_DESCENTS (1.0 / 16)
+/* 오름차순 구간이 이 개수 이하이면 구간끼리만 병합 (병합 단계 수 log2(구간 수)) */
+#define AUTO_MAX_RUNS 16
+
+/* 기록 함수와 user_data는 logger_mutex 안에서 함께 바꾸고 읽음 (등록되지 않았으면 잠그지 않도록 has_logger를 먼저 확인) */
+static void (*decision_log_func_ptr)(const SortDecision *decision, void *user_data) = NULL;
+static void *decision_log_user_data = NULL;
+static volatile size_t has_logger = 0;
+static SortMutex logger_mutex = SORT_MUTEX_INIT;
+
+static void probe_input(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, SortDecision *decision, size_t *run_bounds);
+static int is_sorted_from(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, int descending);
+static size_t find_runs(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *run_bounds);
+static int merge_runs(char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *run_bounds, size_t num_runs);
+static void reverse_elements(char *arr, size_t num_of_elements, size_t size_of_element);
+
+/* [공개 함수] 자동 정렬 */
+int auto_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    return auto_sort_ex(arr, num_of_elements, size_of_element, cmp_func_ptr, NULL);
+}
+
+/* [공개 함수] 선택 결과를 돌려주는 자동 정렬 */
+int auto_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), SortDecision *decision)
+{
+    SortDecision local_decision;
+    if (decision == NULL)
+    {
+        decision = &local_decision;
+    }
+    memset(decision, 0, sizeof(SortDecision));
+    size_t run_bounds[AUTO_MAX_RUNS + 1];
+    decision->num_of_elements = num_of_elements;
+    decision->size_of_element = size_of_element;
+    decision->num_threads = sort_worker_count();
+    decision->engine = SORT_ENGINE_NONE;
+    decision->reason = "empty input";
+
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    if (num_of_elements <= sort_tuning_current()->auto_insertion_limit)
+    {
+        decision->num_threads = 1;
+        decision->engine = SORT_ENGINE_INSERTION_BINARY;
+        decision->reason = "small input";
+    }
+    else
+    {
+        probe_input((const char *)arr, num_of_elements, size_of_element, cmp_func_ptr, decision, run_bounds);
+    }
+
+    if (sort_atomic_load_acquire(&has_logger))
+    {
+        sort_mutex_lock(&logger_mutex);
+        void (*log_func_ptr)(const SortDecision *decision, void *user_data) = decision_log_func_ptr;
+        void *user_data = decision_log_user_data;
+        sort_mutex_unlock(&logger_mutex);
+        if (log_func_ptr != NULL)
+        {
+            log_func_ptr(decision, user_data);
+        }
+    }
+
+    switch (decision->engine)
+    {
+    case SORT_ENGINE_INSERTION_BINARY:
+        insertion_sort_binary(arr, num_of_elements, size_of_element, cmp_func_ptr);
+        return 0;
+    case SORT_ENGINE_NONE:
+        return 0;
+    case SORT_ENGINE_REVERSE:
+        reverse_elements((char *)arr, num_of_elements, size_of_element);
+        return 0;
+    case SORT_ENGINE_FEW_UNIQUE:
+        return sort_few_unique(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    case SORT_ENGINE_MERGE_RUNS:
+        return merge_runs((char *)arr, num_of_elements, size_of_element, cmp_func_ptr, run_bounds, decision->num_runs);
+    case SORT_ENGINE_MERGE_PP:
+        return merge_sort_pp(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    case SORT_ENGINE_MERGE_MULTI:
+        return merge_sort_multi(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    case SORT_ENGINE_MERGE:
+    default:
+        return merge_sort(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+}
+
+/* [공개 함수] 선택 결과 기록 함수 등록 */
+void auto_sort_set_logger(void (*log_func_ptr)(const SortDecision *decision, void *user_data), void *user_data)
+{
+    sort_mutex_lock(&logger_mutex);
+    decision_log_func_ptr = log_func_ptr;
+    decision_log_user_data = user_data;
+    sort_atomic_store_release(&has_logger, log_func_ptr != NULL);
+    sort_mutex_unlock(&logger_mutex);
+}
+
+/* [공개 함수] 엔진 이름 */
+const char *sort_engine_name(SortEngine engine)
+{
+    switch (engine)
+    {
+    case SORT_ENGINE_NONE:
+        return "none";
+    case SORT_ENGINE_REVERSE:
+        return "reverse";
+    case SORT_ENGINE_INSERTION_BINARY:
+        return "insertion_sort_binary";
+    case SORT_ENGINE_MERGE:
+        return "merge_sort";
+    case SORT_ENGINE_MERGE_MULTI:
+        return "merge_sort_multi";
+    case SORT_ENGINE_MERGE_PP:
+        return "merge_sort_pp";
+    case SORT_ENGINE_FEW_UNIQUE:
+        return "sort_few_unique";
+    case SORT_ENGINE_MERGE_RUNS:
+        return "merge_runs";
+    default:
+        return "unknown";
+    }
+}
+
+/* 표본 조사 후 decision에 엔진과 근거를 기록 (구간 병합을 고르면 구간 경계를 run_bounds에 기록) */
+static void probe_input(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, SortDecision *decision, size_t *run_bounds)
+{
+    /* 고르게 퍼진 이웃 원소 쌍의 순서로 정렬된 정도 추정 */
+    size_t num_pairs = (num_of_elements - 1 < SORT_AUTO_PROBE_SAMPLES) ? num_of_elements - 1 : SORT_AUTO_PROBE_SAMPLES;
+    size_t num_ascending = 0;
+    size_t num_descending = 0;
+    for (size_t i = 0; i < num_pairs; i++)
+    {
+        size_t index = (num_of_elements - 1) / num_pairs * i;
+        int result = sort_compare(cmp_func_ptr, arr + index * size_of_element, arr + (index + 1) * size_of_element);
+        num_ascending += (result <= 0);
+        num_descending += (result > 0);
+    }
+    decision->sorted_ratio = (double)num_ascending / num_pairs;
+
+    /* 표본이 거의 오름차순이면 전체를 훑어, 이미 정렬되었거나 오름차순 구간이 몇 개뿐인 입력은 바로 처리 */
+    if (num_descending <= AUTO_NEARLY_SORTED_DESCENTS * num_pairs)
+    {
+        size_t num_runs = find_runs(arr, num_of_elements, size_of_element, cmp_func_ptr, run_bounds);
+        if (num_runs == 1)
+        {
+            decision->num_runs = 1;
+            decision->engine = SORT_ENGINE_NONE;
+            decision->reason = "already sorted";
+            return;
+        }
+        if (num_runs <= AUTO_MAX_RUNS)
+        {
+            decision->num_runs = num_runs;
+            decision->num_threads = 1;
+            decision->engine = SORT_ENGINE_MERGE_RUNS;
+            decision->reason = "few sorted runs";
+            return;
+        }
+    }
+    /* 표본이 모두 내림차순이면 전체를 확인하여 엄격한 역순인 입력은 뒤집기 */
+    if (num_descending == num_pairs && is_sorted_from(arr, num_of_elements, size_of_element, cmp_func_ptr, 1))
+    {
+        /* 엄격한 역순이면 같은 원소가 없으므로 뒤집어도 안정성이 유지됨 */
+        decision->engine = SORT_ENGINE_REVERSE;
+        decision->reason = "strictly descending";
+        return;
+    }
+
+    /* 고정 시드 표본을 정렬하여 서로 다른 값의 비율 추정 */
+    size_t num_samples = (num_of_elements < SORT_AUTO_PROBE_SAMPLES) ? num_of_elements : SORT_AUTO_PROBE_SAMPLES;
+    char *samples = (char *)sort_malloc(2 * num_samples * size_of_element);
+    if (samples != NULL)
+    {
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        size_t stride = num_of_elements / num_samples;
+        for (size_t i = 0; i < num_samples; i++)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            size_t index = i * stride + (size_t)(state % stride);
+            sort_memcpy(samples + i * size_of_element, arr + index * size_of_element, size_of_element);
+        }
+        internal_merge_sort(samples, samples + num_samples * size_of_element, size_of_element, 0, num_samples - 1, cmp_func_ptr);
+        size_t num_distinct = 1;
+        for (size_t i = 1; i < num_samples; i++)
+        {
+            num_distinct += (sort_compare(cmp_func_ptr, samples + (i - 1) * size_of_element, samples + i * size_of_element) != 0);
+        }
+        decision->duplicate_ratio = 1.0 - (double)num_distinct / num_samples;
+        sort_free(samples);
+
+        if (num_distinct * 1000 <= sort_tuning_current()->auto_few_unique_permille * num_samples)
+        {
+            decision->engine = SORT_ENGINE_FEW_UNIQUE;
+            decision->reason = "few unique keys";
+            return;
+        }
+    }
+
+    int is_parallel = (decision->num_threads > 1 && num_of_elements >= 2 * SORT_PARALLEL_THRESHOLD);
+    if (!is_parallel)
+    {
+        decision->num_threads = 1;
+        decision->engine = SORT_ENGINE_MERGE;
+        decision->reason = (num_of_elements < 2 * SORT_PARALLEL_THRESHOLD) ? "below parallel threshold" : "single core";
+        return;
+    }
+    /* 원소 크기가 튜닝 값보다 크면 복사가 비싸므로 병합 후 되돌려 쓰지 않는 더블 버퍼링 엔진 사용 */
+    if (size_of_element > sort_tuning_current()->wide_element)
+    {
+        decision->engine = SORT_ENGINE_MERGE_PP;
+        decision->reason = "wide elements, avoid copy-back";
+        return;
+    }
+    decision->engine = SORT_ENGINE_MERGE_MULTI;
+    decision->reason = "large input";
+}
+
+/* 처음부터 끝까지 오름차순(descending이면 엄격한 내림차순)인지 확인 */
+static int is_sorted_from(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, int descending)
+{
+    const char *current = arr;
+    for (size_t i = 1; i < num_of_elements; i++)
+    {
+        int result = sort_compare(cmp_func_ptr, current, current + size_of_element);
+        if (descending ? (result <= 0) : (result > 0))
+        {
+            return 0;
+        }
+        current += size_of_element;
+    }
+    return 1;
+}
+
+static void reverse_elements(char *arr, size_t num_of_elements, size_t size_of_element)
+{
+    char *front = arr;
+    char *back = arr + (num_of_elements - 1) * size_of_element;
+    while (front < back)
+    {
+        generic_swap(front, back, size_of_element);
+        front += size_of_element;
+        back -= size_of_element;
+    }
+}
+
+/* 오름차순 구간의 시작 위치를 run_bounds에 기록하고 구간 수를 반환, AUTO_MAX_RUNS개를 넘으면 바로 AUTO_MAX_RUNS + 1을 반환 */
+static size_t find_runs(const char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *run_bounds)
+{
+    size_t num_runs = 1;
+    run_bounds[0] = 0;
+    const char *current = arr;
+    for (size_t i = 1; i < num_of_elements; i++)
+    {
+        if (sort_compare(cmp_func_ptr, current, current + size_of_element) > 0)
+        {
+            if (num_runs == AUTO_MAX_RUNS)
+            {
+                return AUTO_MAX_RUNS + 1;
+            }
+            run_bounds[num_runs++] = i;
+        }
+        current += size_of_element;
+    }
+    run_bounds[num_runs] = num_of_elements;
+    return num_runs;
+}
+
+/* 이웃한 오름차순 구간끼리 안정 병합하는 단계를 구간이 하나가 될 때까지 반복 (run_bounds는 덮어씀) */
+static int merge_runs(char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *run_bounds, size_t num_runs)
+{
+    char *tmp_arr = (char *)sort_malloc(num_of_elements * size_of_element);
+    if (SORT_UNLIKELY(tmp_arr == NULL))
+    {
+        return -1;
+    }
+    char *src = arr;
+    char *dest = tmp_arr;
+    while (num_runs > 1)
+    {
+        size_t num_merged = 0;
+        for (size_t r = 0; r < num_runs; r += 2)
+        {
+            size_t begin = run_bounds[r];
+            size_t middle = run_bounds[r + 1];
+            size_t end = (r + 1 < num_runs) ? run_bounds[r + 2] : middle; // 짝이 없는 마지막 구간은 그대로 복사
+            const char *left = src + begin * size_of_element;
+            const char *left_end = src + middle * size_of_element;
+            const char *right = left_end;
+            const char *right_end = src + end * size_of_element;
+            char *out = dest + begin * size_of_element;
+            while (left < left_end && right < right_end)
+            {
+                /* 같으면 왼쪽 구간을 먼저 보내 안정성 유지 */
+                if (sort_compare(cmp_func_ptr, left, right) <= 0)
+                {
+                    sort_memcpy(out, left, size_of_element);
+                    left += size_of_element;
+                }
+                else
+                {
+                    sort_memcpy(out, right, size_of_element);
+                    right += size_of_element;
+                }
+                out += size_of_element;
+            }
+            sort_memcpy(out, left, left_end - left);
+            out += left_end - left;
+            sort_memcpy(out, right, right_end - right);
+            run_bounds[num_merged++] = begin;
+        }
+        run_bounds[num_merged] = num_of_elements;
+        num_runs = num_merged;
+        char *swap = src;
+        src = dest;
+        dest = swap;
+    }
+    if (src != arr)
+    {
+        sort_memcpy(arr, src, num_of_elements * size_of_element);
+    }
+    sort_free(tmp_arr);
+    return 0;
+}
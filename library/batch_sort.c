@@ -0,0 +1,200 @@
+/**
+ * @file batch_sort.c
+ * @brief 여러 개의 작은 배열을 한 번에 정렬하는 묶음 정렬 구현부
+ *
+ * 배열을 크기 구간별로 모아 같은 방식으로 연속 처리하고(분기 예측 유지),
+ * 스레드마다 임시 버퍼를 한 번만 할당하여 묶음 안의 모든 배열이 공유함
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수 이하는 삽입 정렬 */
+#define BATCH_INSERTION_LIMIT 16
+/* 이 개수 이하는 이진 삽입 정렬, 초과하면 병합 정렬 */
+#define BATCH_BINARY_INSERTION_LIMIT 64
+#define BATCH_NUM_CLASSES 5
+
+/* 멀티스레드 인자 전달용 구조체, order[begin, end) 순서의 배열을 담당 */
+typedef struct BatchArgStruct
+{
+    void **arrays;
+    const size_t *counts;
+    const size_t *order;
+    size_t begin;
+    size_t end;
+    size_t size_of_element;
+    CmpFunc cmp_func_ptr;
+    int result;
+} BatchArg;
+
+static inline int size_class(size_t num_of_elements);
+static inline size_t sort_cost(size_t num_of_elements);
+static SORT_THREAD_PROC batch_worker(void *arg);
+
+/* [공개 함수] 묶음 정렬 */
+int sort_batch(void **arrays, const size_t *counts, size_t num_arrays, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arrays == NULL || counts == NULL || num_arrays == 0 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    size_t *order = (size_t *)sort_malloc(num_arrays * sizeof(size_t));
+    if (SORT_UNLIKELY(order == NULL))
+    {
+        return -1;
+    }
+
+    /* 크기 구간별 계수 정렬로 처리 순서를 정함 (같은 구간 안에서는 입력 순서 유지) */
+    size_t class_start[BATCH_NUM_CLASSES + 1] = {0};
+    size_t total_elements = 0;
+    size_t total_cost = 0;
+    for (size_t i = 0; i < num_arrays; i++)
+    {
+        class_start[size_class(counts[i]) + 1]++;
+        total_elements += counts[i];
+        total_cost += sort_cost(counts[i]);
+    }
+    for (int c = 0; c < BATCH_NUM_CLASSES; c++)
+    {
+        class_start[c + 1] += class_start[c];
+    }
+    for (size_t i = 0; i < num_arrays; i++)
+    {
+        order[class_start[size_class(counts[i])]++] = i;
+    }
+
+    /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+    int cpu_count = sort_worker_count();
+    int num_workers = (total_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(total_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers < 1)
+    {
+        num_workers = 1;
+    }
+    BatchArg *args = (BatchArg *)sort_malloc(num_workers * sizeof(BatchArg));
+    if (SORT_UNLIKELY(args == NULL))
+    {
+        sort_free(order);
+        return -1;
+    }
+
+    /* 예상 비용(n log n)이 고르게 나뉘도록 순서 목록을 연속 구간으로 자름 */
+    size_t begin = 0;
+    size_t cost_so_far = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        size_t target = total_cost / num_workers * (t + 1);
+        size_t end = begin;
+        if (t == num_workers - 1)
+        {
+            end = num_arrays;
+        }
+        else
+        {
+            while (end < num_arrays && cost_so_far < target)
+            {
+                cost_so_far += sort_cost(counts[order[end]]);
+                end++;
+            }
+        }
+        BatchArg batch_arg = {arrays, counts, order, begin, end, size_of_element, cmp_func_ptr, 0};
+        args[t] = batch_arg;
+        begin = end;
+    }
+
+    sort_run_workers(batch_worker, args, sizeof(BatchArg), num_workers);
+
+    int result = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        if (args[t].result != 0)
+        {
+            result = args[t].result;
+        }
+    }
+    sort_free(args);
+    sort_free(order);
+    return result;
+}
+
+/* 정렬 방식이 같은 크기끼리 묶기 위한 구간 번호 */
+static inline int size_class(size_t num_of_elements)
+{
+    if (num_of_elements <= BATCH_INSERTION_LIMIT)
+    {
+        return 0;
+    }
+    if (num_of_elements <= BATCH_BINARY_INSERTION_LIMIT)
+    {
+        return 1;
+    }
+    if (num_of_elements <= 256)
+    {
+        return 2;
+    }
+    if (num_of_elements <= 1024)
+    {
+        return 3;
+    }
+    return 4;
+}
+
+/* 스레드 분배용 예상 비용 n * ceil(log2(n + 1)) */
+static inline size_t sort_cost(size_t num_of_elements)
+{
+    size_t levels = 1;
+    while (((size_t)1 << levels) <= num_of_elements && levels < sizeof(size_t) * 8 - 1)
+    {
+        levels++;
+    }
+    return num_of_elements * levels;
+}
+
+/* 담당 배열들을 순서대로 정렬, 병합 정렬용 임시 버퍼는 가장 큰 배열 기준으로 한 번만 할당 */
+static SORT_THREAD_PROC batch_worker(void *arg)
+{
+    BatchArg *arg_ptr = (BatchArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+
+    size_t max_count = 0;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        size_t count = arg_ptr->counts[arg_ptr->order[i]];
+        if (count > BATCH_BINARY_INSERTION_LIMIT && count > max_count)
+        {
+            max_count = count;
+        }
+    }
+    void *tmp_arr = NULL;
+    if (max_count > 0)
+    {
+        tmp_arr = sort_malloc(max_count * size_of_element);
+        if (SORT_UNLIKELY(tmp_arr == NULL))
+        {
+            arg_ptr->result = -1;
+        }
+    }
+
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        void *arr = arg_ptr->arrays[arg_ptr->order[i]];
+        size_t count = arg_ptr->counts[arg_ptr->order[i]];
+        if (count <= BATCH_INSERTION_LIMIT)
+        {
+            insertion_sort(arr, count, size_of_element, arg_ptr->cmp_func_ptr);
+        }
+        else if (count <= BATCH_BINARY_INSERTION_LIMIT)
+        {
+            insertion_sort_binary(arr, count, size_of_element, arg_ptr->cmp_func_ptr);
+        }
+        else if (tmp_arr != NULL && arr != NULL)
+        {
+            internal_merge_sort(arr, tmp_arr, size_of_element, 0, count - 1, arg_ptr->cmp_func_ptr);
+        }
+    }
+    sort_free(tmp_arr);
+    return 0;
+}
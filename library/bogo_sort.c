@@ -12,8 +12,7 @@
 #include <stdint.h>
 #include <time.h>
 #include "sorting.h"
-
-typedef int (*CmpFunc)(const void *a_ptr, const void *b_ptr);
+#include "sort_internal.h"
 
 static inline uint64_t xorshift64(void);
 static inline uint64_t mul128(uint64_t a, uint64_t b, uint64_t *low);
@@ -124,7 +123,7 @@ static inline int is_sorted(void *SORT_RESTRICT arr, size_t num_of_elements, siz
     {
         void *current = (char *)arr + (i * size_of_element);
         void *next = (char *)current + size_of_element;
-        if (cmp_func_ptr(current, next) > 0)
+        if (sort_compare(cmp_func_ptr, current, next) > 0)
         {
             return 0;
         }
@@ -136,12 +135,12 @@ static inline int is_sorted(void *SORT_RESTRICT arr, size_t num_of_elements, siz
 static int is_bogobogo_sorted(void *SORT_RESTRICT arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr)
 {
     /* 복사본 생성 */
-    void *copy = malloc(num_of_elements * size_of_element);
+    void *copy = sort_malloc(num_of_elements * size_of_element);
     if (SORT_UNLIKELY(copy == NULL))
     {
         return 0;
     }
-    memcpy(copy, arr, num_of_elements * size_of_element);
+    sort_memcpy(copy, arr, num_of_elements * size_of_element);
 
     /* 복사본의 앞 n - 1개를 보고보고 정렬 */
     bogobogo_sort(copy, num_of_elements - 1, size_of_element, cmp_func_ptr);
@@ -150,7 +149,7 @@ static int is_bogobogo_sorted(void *SORT_RESTRICT arr, size_t num_of_elements, s
     void *prev_max = (char *)last - size_of_element;
 
     /* n번째 요소가 정렬될 때까지 셔플 및 재정렬 */
-    while (cmp_func_ptr(prev_max, last) > 0)
+    while (sort_compare(cmp_func_ptr, prev_max, last) > 0)
     {
         shuffle(copy, num_of_elements, size_of_element);
         bogobogo_sort(copy, num_of_elements - 1, size_of_element, cmp_func_ptr);
@@ -158,7 +157,7 @@ static int is_bogobogo_sorted(void *SORT_RESTRICT arr, size_t num_of_elements, s
 
     /* 원본과 정렬된 복사본 비교 */
     int result = (memcmp(arr, copy, num_of_elements * size_of_element) == 0);
-    free(copy);
+    sort_free(copy);
     return result;
 }
 
@@ -5,6 +5,7 @@
 
 #include <stddef.h>
 #include "sorting.h"
+#include "sort_internal.h"
 
 /* [공개 함수] 버블 정렬 */
 void bubble_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
@@ -20,7 +21,7 @@ void bubble_sort(void *arr, size_t num_of_elements, size_t size_of_element, int
         void *next = (char *)arr + size_of_element;
         for (size_t j = 0; j < i; j++)
         {
-            if (cmp_func_ptr(current, next) > 0)
+            if (sort_compare(cmp_func_ptr, current, next) > 0)
             {
                 generic_swap(current, next, size_of_element);
                 is_swapped = 1;
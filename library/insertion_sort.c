@@ -6,8 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "sorting.h"
-
-typedef int (*CmpFunc)(const void *a_ptr, const void *b_ptr);
+#include "sort_internal.h"
 
 static void *binary_pos_search(void *arr, void *value, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr);
 
@@ -29,7 +28,7 @@ void insertion_sort(void *arr, size_t num_of_elements, size_t size_of_element, i
     }
     else
     {
-        tmp = malloc(size_of_element);
+        tmp = sort_malloc(size_of_element);
         if (SORT_UNLIKELY(tmp == NULL))
         {
             return;
@@ -44,7 +43,7 @@ void insertion_sort(void *arr, size_t num_of_elements, size_t size_of_element, i
         void *pos = arr;
         for (size_t j = i; j-- > 0;) // i번 반복
         {
-            if (cmp_func_ptr(scan, current) <= 0) // 삽입 조건
+            if (sort_compare(cmp_func_ptr, scan, current) <= 0) // 삽입 조건
             {
                 pos = (char *)scan + size_of_element;
                 break;
@@ -53,16 +52,16 @@ void insertion_sort(void *arr, size_t num_of_elements, size_t size_of_element, i
         }
         if (SORT_LIKELY(pos != current))
         {
-            memcpy(tmp, current, size_of_element);
-            memmove((char *)pos + size_of_element, pos, (char *)current - (char *)pos);
-            memcpy(pos, tmp, size_of_element);
+            sort_memcpy(tmp, current, size_of_element);
+            sort_memmove((char *)pos + size_of_element, pos, (char *)current - (char *)pos);
+            sort_memcpy(pos, tmp, size_of_element);
         }
         current = (char *)current + size_of_element;
     }
 
     if (is_heap) // tmp를 힙 영역에 동적할당 하였다면 메모리 해제
     {
-        free(tmp);
+        sort_free(tmp);
     }
 }
 
@@ -84,7 +83,7 @@ void insertion_sort_binary(void *arr, size_t num_of_elements, size_t size_of_ele
     }
     else
     {
-        tmp = malloc(size_of_element);
+        tmp = sort_malloc(size_of_element);
         if (SORT_UNLIKELY(tmp == NULL))
         {
             return;
@@ -98,16 +97,16 @@ void insertion_sort_binary(void *arr, size_t num_of_elements, size_t size_of_ele
         void *pos = binary_pos_search(arr, current, i, size_of_element, cmp_func_ptr);
         if (SORT_LIKELY(pos != current))
         {
-            memcpy(tmp, current, size_of_element);
-            memmove((char *)pos + size_of_element, pos, (char *)current - (char *)pos);
-            memcpy(pos, tmp, size_of_element);
+            sort_memcpy(tmp, current, size_of_element);
+            sort_memmove((char *)pos + size_of_element, pos, (char *)current - (char *)pos);
+            sort_memcpy(pos, tmp, size_of_element);
         }
         current = (char *)current + size_of_element;
     }
 
     if (is_heap) // tmp를 힙 영역에 동적할당 하였다면 메모리 해제
     {
-        free(tmp);
+        sort_free(tmp);
     }
 }
 
@@ -121,7 +120,7 @@ static void *binary_pos_search(void *arr, void *value, size_t num_of_elements, s
     {
         size_t mid = lo + (hi - lo) / 2;
         void *mid_ptr = (char *)arr + (mid * size_of_element);
-        if (cmp_func_ptr(value, mid_ptr) < 0) // mid 번째 값보다 작으면
+        if (sort_compare(cmp_func_ptr, value, mid_ptr) < 0) // mid 번째 값보다 작으면
         {
             hi = mid;
         }
@@ -0,0 +1,451 @@
+/**
+ * @file key_sort.c
+ * @brief 키 명세(SortKey) 기반 다중 키 정렬 구현부
+ *
+ * 각 원소의 키들을 memcmp 순서가 곧 정렬 순서가 되는 정규화 키로 바꾼 뒤,
+ * [정규화 키 | 원래 위치] 레코드를 바이트 단위 LSD 기수 정렬(안정 정렬)로 정렬하고 원소를 한 번만 옮김
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수 이하는 레코드를 memcmp 기반 삽입 정렬로 정렬 */
+#define KEY_INSERTION_LIMIT 32
+#define RADIX_SIZE 256
+
+/* 멀티스레드 인자 전달용 구조체, [begin, end) 구간을 담당 */
+typedef struct RadixArgStruct
+{
+    const SortKey *keys;
+    size_t num_keys;
+    const char *arr;
+    size_t size_of_element;
+    unsigned char *src;
+    unsigned char *dest;
+    size_t record_size;
+    size_t byte_index;
+    size_t begin;
+    size_t end;
+    size_t count[RADIX_SIZE];
+} RadixArg;
+
+static size_t key_type_width(const SortKey *key);
+static void store_big_endian(unsigned char *out, unsigned long long value, size_t width);
+static void radix_sort_records(unsigned char **records, unsigned char **tmp_records, size_t num_of_elements, size_t key_width, RadixArg *args, int num_workers);
+static void insertion_sort_records(unsigned char *records, unsigned char *tmp_record, size_t num_of_elements, size_t record_size, size_t key_width);
+static void split_range(RadixArg *args, int num_workers, size_t num_of_elements);
+static SORT_THREAD_PROC build_chunk(void *arg);
+static SORT_THREAD_PROC count_chunk(void *arg);
+static SORT_THREAD_PROC scatter_chunk(void *arg);
+static SORT_THREAD_PROC gather_chunk(void *arg);
+
+/* [공개 함수] 정규화 키의 바이트 수 */
+size_t sort_key_width(const SortKey *keys, size_t num_keys)
+{
+    size_t width = 0;
+    for (size_t k = 0; k < num_keys; k++)
+    {
+        width += key_type_width(&keys[k]);
+    }
+    return width;
+}
+
+/* [공개 함수] 원소 하나의 정규화 키 생성 */
+void sort_key_normalize(const SortKey *keys, size_t num_keys, const void *element, unsigned char *out)
+{
+    const char *base = (const char *)element;
+    for (size_t k = 0; k < num_keys; k++)
+    {
+        const SortKey *key = &keys[k];
+        const char *field = base + key->offset;
+        size_t width = key_type_width(key);
+        switch (key->type)
+        {
+        case SORT_KEY_INT8:
+        {
+            signed char value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, (unsigned long long)(unsigned char)value ^ 0x80ULL, width);
+            break;
+        }
+        case SORT_KEY_INT16:
+        {
+            short value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, (unsigned long long)(unsigned short)value ^ 0x8000ULL, width);
+            break;
+        }
+        case SORT_KEY_INT32:
+        {
+            int value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, (unsigned long long)(unsigned int)value ^ 0x80000000ULL, width);
+            break;
+        }
+        case SORT_KEY_INT64:
+        {
+            long long value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, (unsigned long long)value ^ 0x8000000000000000ULL, width);
+            break;
+        }
+        case SORT_KEY_UINT8:
+        {
+            unsigned char value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, value, width);
+            break;
+        }
+        case SORT_KEY_UINT16:
+        {
+            unsigned short value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, value, width);
+            break;
+        }
+        case SORT_KEY_UINT32:
+        {
+            unsigned int value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, value, width);
+            break;
+        }
+        case SORT_KEY_UINT64:
+        {
+            unsigned long long value;
+            sort_memcpy(&value, field, sizeof(value));
+            store_big_endian(out, value, width);
+            break;
+        }
+        case SORT_KEY_FLOAT:
+        {
+            float value;
+            unsigned int bits = 0;
+            sort_memcpy(&value, field, sizeof(value));
+            if (value != 0.0f) // -0.0과 0.0은 같은 키
+            {
+                sort_memcpy(&bits, &value, sizeof(bits));
+            }
+            bits = (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+            store_big_endian(out, bits, width);
+            break;
+        }
+        case SORT_KEY_DOUBLE:
+        {
+            double value;
+            unsigned long long bits = 0;
+            sort_memcpy(&value, field, sizeof(value));
+            if (value != 0.0)
+            {
+                sort_memcpy(&bits, &value, sizeof(bits));
+            }
+            bits = (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+            store_big_endian(out, bits, width);
+            break;
+        }
+        case SORT_KEY_STRING:
+        {
+            /* 널 문자 뒤의 바이트는 무시하고 0으로 채움 (strncmp 순서) */
+            const char *end = (const char *)memchr(field, '\0', width);
+            size_t length = (end != NULL) ? (size_t)(end - field) : width;
+            sort_memcpy(out, field, length);
+            memset(out + length, 0, width - length);
+            break;
+        }
+        default:
+            memset(out, 0, width);
+            break;
+        }
+        if (key->direction == SORT_DESCENDING)
+        {
+            for (size_t i = 0; i < width; i++)
+            {
+                out[i] = (unsigned char)~out[i];
+            }
+        }
+        out += width;
+    }
+}
+
+/* [공개 함수] 키 명세에 따른 두 원소 비교 */
+int sort_key_compare(const SortKey *keys, size_t num_keys, const void *a_ptr, const void *b_ptr)
+{
+    unsigned char a_key[64];
+    unsigned char b_key[64];
+    for (size_t k = 0; k < num_keys; k++)
+    {
+        size_t width = key_type_width(&keys[k]);
+        if (width > sizeof(a_key))
+        {
+            /* 긴 문자열 키는 정규화 없이 직접 비교 */
+            const char *a_field = (const char *)a_ptr + keys[k].offset;
+            const char *b_field = (const char *)b_ptr + keys[k].offset;
+            int result = strncmp(a_field, b_field, width);
+            result = (result > 0) - (result < 0);
+            if (result != 0)
+            {
+                return (keys[k].direction == SORT_DESCENDING) ? -result : result;
+            }
+            continue;
+        }
+        sort_key_normalize(&keys[k], 1, a_ptr, a_key);
+        sort_key_normalize(&keys[k], 1, b_ptr, b_key);
+        int result = memcmp(a_key, b_key, width);
+        if (result != 0)
+        {
+            return (result > 0) - (result < 0);
+        }
+    }
+    return 0;
+}
+
+/* [공개 함수] 키 명세 기반 정렬 */
+int sort_by_keys(void *arr, size_t num_of_elements, size_t size_of_element, const SortKey *keys, size_t num_keys)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements < 2 || size_of_element == 0 || keys == NULL || num_keys == 0))
+    {
+        return 0;
+    }
+
+    size_t key_width = sort_key_width(keys, num_keys);
+    size_t record_size = key_width + sizeof(size_t);
+
+    /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_of_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(num_of_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers < 1)
+    {
+        num_workers = 1;
+    }
+
+    unsigned char *records = (unsigned char *)sort_malloc(num_of_elements * record_size);
+    unsigned char *tmp_records = (unsigned char *)sort_malloc(num_of_elements * record_size);
+    char *tmp_arr = (char *)sort_malloc(num_of_elements * size_of_element);
+    RadixArg *args = (RadixArg *)sort_malloc(num_workers * sizeof(RadixArg));
+    if (SORT_UNLIKELY(records == NULL || tmp_records == NULL || tmp_arr == NULL || args == NULL))
+    {
+        sort_free(records);
+        sort_free(tmp_records);
+        sort_free(tmp_arr);
+        sort_free(args);
+        return -1;
+    }
+
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].keys = keys;
+        args[t].num_keys = num_keys;
+        args[t].arr = (const char *)arr;
+        args[t].size_of_element = size_of_element;
+        args[t].record_size = record_size;
+    }
+    split_range(args, num_workers, num_of_elements);
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].dest = records;
+    }
+    sort_run_workers(build_chunk, args, sizeof(RadixArg), num_workers);
+
+    if (num_of_elements <= KEY_INSERTION_LIMIT)
+    {
+        insertion_sort_records(records, tmp_records, num_of_elements, record_size, key_width);
+    }
+    else
+    {
+        radix_sort_records(&records, &tmp_records, num_of_elements, key_width, args, num_workers);
+    }
+
+    /* 원래 위치 순서대로 원소를 모은 뒤 한 번에 되돌려 씀 */
+    split_range(args, num_workers, num_of_elements);
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].src = records;
+        args[t].dest = (unsigned char *)tmp_arr;
+    }
+    sort_run_workers(gather_chunk, args, sizeof(RadixArg), num_workers);
+    sort_memcpy(arr, tmp_arr, num_of_elements * size_of_element);
+
+    sort_free(records);
+    sort_free(tmp_records);
+    sort_free(tmp_arr);
+    sort_free(args);
+    return 0;
+}
+
+/* 키 하나가 정규화 키에서 차지하는 바이트 수 */
+static size_t key_type_width(const SortKey *key)
+{
+    switch (key->type)
+    {
+    case SORT_KEY_INT8:
+    case SORT_KEY_UINT8:
+        return 1;
+    case SORT_KEY_INT16:
+    case SORT_KEY_UINT16:
+        return 2;
+    case SORT_KEY_INT32:
+    case SORT_KEY_UINT32:
+    case SORT_KEY_FLOAT:
+        return 4;
+    case SORT_KEY_INT64:
+    case SORT_KEY_UINT64:
+    case SORT_KEY_DOUBLE:
+        return 8;
+    case SORT_KEY_STRING:
+        return key->length;
+    default:
+        return 0;
+    }
+}
+
+/* value의 하위 width 바이트를 상위 바이트부터 기록 */
+static void store_big_endian(unsigned char *out, unsigned long long value, size_t width)
+{
+    for (size_t i = width; i > 0; i--)
+    {
+        out[i - 1] = (unsigned char)(value & 0xFF);
+        value >>= 8;
+    }
+}
+
+/* 정규화 키의 마지막 바이트부터 한 바이트씩 안정 분배, 모든 원소가 같은 바이트인 단계는 건너뜀 */
+static void radix_sort_records(unsigned char **records, unsigned char **tmp_records, size_t num_of_elements, size_t key_width, RadixArg *args, int num_workers)
+{
+    split_range(args, num_workers, num_of_elements);
+    for (size_t byte_index = key_width; byte_index > 0; byte_index--)
+    {
+        for (int t = 0; t < num_workers; t++)
+        {
+            args[t].src = *records;
+            args[t].dest = *tmp_records;
+            args[t].byte_index = byte_index - 1;
+        }
+        sort_run_workers(count_chunk, args, sizeof(RadixArg), num_workers);
+
+        /* 바이트 값 순서, 같은 값 안에서는 스레드 순서로 쓸 위치를 정함 */
+        size_t position = 0;
+        int is_trivial = 0;
+        for (int digit = 0; digit < RADIX_SIZE; digit++)
+        {
+            size_t digit_start = position;
+            for (int t = 0; t < num_workers; t++)
+            {
+                size_t count = args[t].count[digit];
+                args[t].count[digit] = position;
+                position += count;
+            }
+            if (position - digit_start == num_of_elements)
+            {
+                is_trivial = 1;
+                break;
+            }
+        }
+        if (is_trivial)
+        {
+            continue;
+        }
+
+        sort_run_workers(scatter_chunk, args, sizeof(RadixArg), num_workers);
+        unsigned char *swap = *records;
+        *records = *tmp_records;
+        *tmp_records = swap;
+    }
+}
+
+/* 작은 입력용 memcmp 기반 삽입 정렬 */
+static void insertion_sort_records(unsigned char *records, unsigned char *tmp_record, size_t num_of_elements, size_t record_size, size_t key_width)
+{
+    for (size_t i = 1; i < num_of_elements; i++)
+    {
+        unsigned char *current = records + i * record_size;
+        size_t j = i;
+        while (j > 0 && memcmp(records + (j - 1) * record_size, current, key_width) > 0)
+        {
+            j--;
+        }
+        if (j < i)
+        {
+            sort_memcpy(tmp_record, current, record_size);
+            sort_memmove(records + (j + 1) * record_size, records + j * record_size, (i - j) * record_size);
+            sort_memcpy(records + j * record_size, tmp_record, record_size);
+        }
+    }
+}
+
+/* 전체 구간을 스레드 수만큼 나눔 */
+static void split_range(RadixArg *args, int num_workers, size_t num_of_elements)
+{
+    size_t chunk = num_of_elements / num_workers;
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].begin = t * chunk;
+        args[t].end = (t == num_workers - 1) ? num_of_elements : (t + 1) * chunk;
+    }
+}
+
+/* 담당 구간의 원소마다 [정규화 키 | 원래 위치] 레코드 생성 */
+static SORT_THREAD_PROC build_chunk(void *arg)
+{
+    RadixArg *arg_ptr = (RadixArg *)arg;
+    size_t key_width = arg_ptr->record_size - sizeof(size_t);
+    unsigned char *record = arg_ptr->dest + arg_ptr->begin * arg_ptr->record_size;
+    const char *element = arg_ptr->arr + arg_ptr->begin * arg_ptr->size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        sort_key_normalize(arg_ptr->keys, arg_ptr->num_keys, element, record);
+        sort_memcpy(record + key_width, &i, sizeof(size_t));
+        record += arg_ptr->record_size;
+        element += arg_ptr->size_of_element;
+    }
+    return 0;
+}
+
+/* 담당 구간에서 현재 바이트 값별 개수 계산 */
+static SORT_THREAD_PROC count_chunk(void *arg)
+{
+    RadixArg *arg_ptr = (RadixArg *)arg;
+    memset(arg_ptr->count, 0, sizeof(arg_ptr->count));
+    const unsigned char *current = arg_ptr->src + arg_ptr->begin * arg_ptr->record_size + arg_ptr->byte_index;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        arg_ptr->count[*current]++;
+        current += arg_ptr->record_size;
+    }
+    return 0;
+}
+
+/* 담당 구간을 계산된 위치로 순서를 유지하며 분배 */
+static SORT_THREAD_PROC scatter_chunk(void *arg)
+{
+    RadixArg *arg_ptr = (RadixArg *)arg;
+    size_t record_size = arg_ptr->record_size;
+    const unsigned char *current = arg_ptr->src + arg_ptr->begin * record_size;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        size_t position = arg_ptr->count[current[arg_ptr->byte_index]]++;
+        sort_memcpy(arg_ptr->dest + position * record_size, current, record_size);
+        current += record_size;
+    }
+    return 0;
+}
+
+/* dest[i] = arr[레코드 i의 원래 위치] */
+static SORT_THREAD_PROC gather_chunk(void *arg)
+{
+    RadixArg *arg_ptr = (RadixArg *)arg;
+    size_t key_width = arg_ptr->record_size - sizeof(size_t);
+    size_t size_of_element = arg_ptr->size_of_element;
+    const unsigned char *record = arg_ptr->src + arg_ptr->begin * arg_ptr->record_size;
+    unsigned char *dest = arg_ptr->dest + arg_ptr->begin * size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        size_t index;
+        sort_memcpy(&index, record + key_width, sizeof(size_t));
+        sort_memcpy(dest, arg_ptr->arr + index * size_of_element, size_of_element);
+        record += arg_ptr->record_size;
+        dest += size_of_element;
+    }
+    return 0;
+}
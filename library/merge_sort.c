@@ -5,14 +5,23 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <windows.h>
-#include <process.h>
 #include "sorting.h"
+#include "sort_internal.h"
 
-/* 병렬 처리를 수행할 최소 데이터 개수 (스레드 과생성 방지) */
-#define THRESHOLD 16384
+/* 이 개수 이하의 구간은 취소/진행률 확인 없이 한 번에 정렬 */
+#define CONTROL_GRANULARITY 65536
 
-typedef int (*CmpFunc)(const void *a_ptr, const void *b_ptr);
+/* 옵션을 받는 정렬(_ex)에서 모든 스레드가 공유하는 상태 */
+typedef struct SortControlStruct
+{
+    const SortOptions *options;
+    unsigned long long deadline_ms;
+    volatile size_t status;         // 0이 아니면 중단 사유 (SORT_ERR_CANCELLED, SORT_ERR_TIMEOUT), 처음 기록한 사유만 남음
+    volatile size_t done_work;      // 병합이 끝난 원소 수의 합 (단계마다 n씩 증가)
+    volatile size_t reported_percent;
+    size_t total_work;              // n * 병합 단계 수
+    SortMutex progress_mutex;       // 진행률 콜백이 동시에, 순서가 뒤바뀌어 호출되지 않도록 직렬화
+} SortControl;
 
 /* 멀티스레드 인자 전달용 구조체 */
 typedef struct ThreadArgStruct
@@ -24,21 +33,21 @@ typedef struct ThreadArgStruct
     size_t right;
     CmpFunc cmp_func_ptr;
     int num_threads;
+    SortControl *control;           // 옵션 없는 정렬에서는 NULL
 } ThreadArg;
 
-static void internal_merge_sort(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr);
-static unsigned __stdcall parallel_internal_sort(void *arg);
+static SORT_THREAD_PROC parallel_internal_sort(void *arg);
+static void internal_merge_sort_control(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, SortControl *control);
+static int run_with_control(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const SortOptions *options, int num_threads);
+static void control_init(SortControl *control, const SortOptions *options, size_t num_of_elements);
+static void control_destroy(SortControl *control);
+static int control_status(SortControl *control);
+static int control_should_stop(SortControl *control);
+static void control_report(SortControl *control, size_t work);
+static size_t count_merge_levels(size_t num_of_elements);
+static void sort_range(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, size_t insertion_cutoff);
 static void merge_to_buffer(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t middle, size_t right, CmpFunc cmp_func_ptr);
 static inline void merge(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t middle, size_t right, CmpFunc cmp_func_ptr);
-static int get_thread_count(void);
-
-/* 시스템의 논리 프로세서 개수 반환 */
-static int get_thread_count(void)
-{
-    SYSTEM_INFO sysinfo;
-    GetSystemInfo(&sysinfo);
-    return sysinfo.dwNumberOfProcessors;
-}
 
 /* [공개 함수] 싱글 스레드 병합 정렬 */
 int merge_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
@@ -47,13 +56,19 @@ int merge_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*
     {
         return 0;
     }
-    void *tmp_arr = malloc(num_of_elements * size_of_element);
+    SORT_TRACE_START(alloc_start);
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    SORT_TRACE_STOP(alloc_start, "alloc", num_of_elements);
     if (SORT_UNLIKELY(tmp_arr == NULL))
     {
         return -1;
     }
+    SORT_TRACE_START(sort_start);
     internal_merge_sort(arr, tmp_arr, size_of_element, 0, num_of_elements - 1, cmp_func_ptr);
-    free(tmp_arr);
+    SORT_TRACE_STOP(sort_start, "leaf sort", num_of_elements);
+    SORT_TRACE_START(free_start);
+    sort_free(tmp_arr);
+    SORT_TRACE_STOP(free_start, "free", num_of_elements);
     return 0;
 }
 
@@ -64,37 +79,235 @@ int merge_sort_multi(void *arr, size_t num_of_elements, size_t size_of_element,
     {
         return 0;
     }
-    void *tmp_arr = malloc(num_of_elements * size_of_element);
+    SORT_TRACE_START(alloc_start);
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    SORT_TRACE_STOP(alloc_start, "alloc", num_of_elements);
     if (SORT_UNLIKELY(tmp_arr == NULL))
     {
         return -1;
     }
 
     /* 시스템에 맞는 적당한 스레드 수 계산 */
-    int sys_cpu_count = get_thread_count();
-    int cpu_count = (sys_cpu_count >= 8) ? sys_cpu_count - 2 : ((sys_cpu_count >= 4) ? sys_cpu_count - 1 : sys_cpu_count);
+    int cpu_count = sort_worker_count();
+
+    ThreadArg initial_arg = {arr, tmp_arr, size_of_element, 0, num_of_elements - 1, cmp_func_ptr, cpu_count, NULL};
+    parallel_internal_sort(&initial_arg);
+    SORT_TRACE_START(free_start);
+    sort_free(tmp_arr);
+    SORT_TRACE_STOP(free_start, "free", num_of_elements);
+    return 0;
+}
+
+/* [공개 함수] 옵션을 받는 싱글 스레드 병합 정렬 */
+int merge_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options)
+{
+    if (options == NULL)
+    {
+        return merge_sort(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+    return run_with_control(arr, num_of_elements, size_of_element, cmp_func_ptr, options, 1);
+}
+
+/* [공개 함수] 옵션을 받는 멀티 스레드 병합 정렬 */
+int merge_sort_multi_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options)
+{
+    return internal_merge_sort_ex(arr, num_of_elements, size_of_element, cmp_func_ptr, options, sort_worker_count());
+}
+
+/* 옵션과 스레드 수를 받는 병합 정렬 (다른 구현 파일에서 사용) */
+int internal_merge_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const SortOptions *options, int num_threads)
+{
+    if (options != NULL)
+    {
+        return run_with_control(arr, num_of_elements, size_of_element, cmp_func_ptr, options, num_threads);
+    }
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return SORT_OK;
+    }
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    if (SORT_UNLIKELY(tmp_arr == NULL))
+    {
+        return SORT_ERR_NOMEM;
+    }
+    internal_merge_sort_multi(arr, tmp_arr, size_of_element, 0, num_of_elements - 1, cmp_func_ptr, num_threads);
+    sort_free(tmp_arr);
+    return SORT_OK;
+}
 
-    ThreadArg initial_arg = {arr, tmp_arr, size_of_element, 0, num_of_elements - 1, cmp_func_ptr, cpu_count};
+/* 주어진 구간을 num_threads개의 스레드로 병합 정렬 (다른 구현 파일에서 사용) */
+void internal_merge_sort_multi(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, int num_threads)
+{
+    ThreadArg initial_arg = {arr, tmp_arr, size_of_element, left, right, cmp_func_ptr, num_threads, NULL};
     parallel_internal_sort(&initial_arg);
-    free(tmp_arr);
+}
+
+/* 옵션을 받는 정렬의 공통 처리부 */
+static int run_with_control(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const SortOptions *options, int num_threads)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return SORT_OK;
+    }
+    SORT_TRACE_START(alloc_start);
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    SORT_TRACE_STOP(alloc_start, "alloc", num_of_elements);
+    if (SORT_UNLIKELY(tmp_arr == NULL))
+    {
+        return SORT_ERR_NOMEM;
+    }
+
+    SortControl control;
+    control_init(&control, options, num_of_elements);
+    if (!control_should_stop(&control))
+    {
+        ThreadArg initial_arg = {arr, tmp_arr, size_of_element, 0, num_of_elements - 1, cmp_func_ptr, num_threads, &control};
+        parallel_internal_sort(&initial_arg);
+    }
+    SORT_TRACE_START(free_start);
+    sort_free(tmp_arr);
+    SORT_TRACE_STOP(free_start, "free", num_of_elements);
+
+    int status = control_status(&control);
+    control_destroy(&control);
+    if (status == 0 && options->progress_func_ptr != NULL)
+    {
+        options->progress_func_ptr(1.0, options->user_data);
+    }
+    return status;
+}
+
+static void control_init(SortControl *control, const SortOptions *options, size_t num_of_elements)
+{
+    control->options = options;
+    control->deadline_ms = (options->timeout_ms != 0) ? sort_now_ms() + options->timeout_ms : 0;
+    control->status = 0;
+    control->done_work = 0;
+    control->reported_percent = 0;
+    control->total_work = num_of_elements * count_merge_levels(num_of_elements);
+    sort_mutex_init(&control->progress_mutex);
+}
+
+static void control_destroy(SortControl *control)
+{
+    sort_mutex_destroy(&control->progress_mutex);
+}
+
+/* 여러 스레드가 동시에 기록하므로 원자적으로 읽음 */
+static int control_status(SortControl *control)
+{
+    return (int)sort_atomic_fetch_add(&control->status, 0);
+}
+
+/* 취소 플래그와 제한 시간을 확인하여 중단해야 하면 사유를 기록하고 1을 반환 */
+static int control_should_stop(SortControl *control)
+{
+    if (control_status(control) != 0)
+    {
+        return 1;
+    }
+    const SortOptions *options = control->options;
+    if (options->cancel_flag != NULL && *options->cancel_flag != 0)
+    {
+        sort_atomic_compare_exchange(&control->status, 0, (size_t)SORT_ERR_CANCELLED);
+        return 1;
+    }
+    if (control->deadline_ms != 0 && sort_now_ms() >= control->deadline_ms)
+    {
+        sort_atomic_compare_exchange(&control->status, 0, (size_t)SORT_ERR_TIMEOUT);
+        return 1;
+    }
     return 0;
 }
 
+/* 완료된 작업량을 더하고, 진행률이 1% 이상 올랐을 때만 콜백 호출 */
+static void control_report(SortControl *control, size_t work)
+{
+    if (control->options->progress_func_ptr == NULL || control->total_work == 0)
+    {
+        return;
+    }
+    size_t done = sort_atomic_fetch_add(&control->done_work, work) + work;
+    size_t percent = (done >= control->total_work) ? 99 : (size_t)((double)done * 100.0 / control->total_work);
+    if (percent <= sort_atomic_fetch_add(&control->reported_percent, 0))
+    {
+        return;
+    }
+    /* 잠금 안에서 다시 확인하고 호출하여, 같은 값을 두 번 알리거나 늦게 도착한 스레드가 더 작은 값을 알리지 않게 함 */
+    sort_mutex_lock(&control->progress_mutex);
+    size_t reported = sort_atomic_fetch_add(&control->reported_percent, 0);
+    if (percent > reported && sort_atomic_compare_exchange(&control->reported_percent, reported, percent))
+    {
+        control->options->progress_func_ptr((double)percent / 100.0, control->options->user_data);
+    }
+    sort_mutex_unlock(&control->progress_mutex);
+}
+
+/* 구간을 절반씩 나눌 때의 병합 단계 수 (ceil(log2 n)) */
+static size_t count_merge_levels(size_t num_of_elements)
+{
+    size_t levels = 0;
+    while (((size_t)1 << levels) < num_of_elements && levels < sizeof(size_t) * 8 - 1)
+    {
+        levels++;
+    }
+    return levels;
+}
+
+/**
+ * 재귀 분할 정렬 (싱글 스레드, 옵션 확인)
+ * CONTROL_GRANULARITY 이하의 구간은 확인 없이 internal_merge_sort로 정렬하고, 큰 구간의 병합 직전에만 중단 여부를 확인
+ */
+static void internal_merge_sort_control(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, SortControl *control)
+{
+    if (left >= right || control_status(control) != 0)
+    {
+        return;
+    }
+    size_t count = right - left + 1;
+    if (count <= CONTROL_GRANULARITY)
+    {
+        internal_merge_sort(arr, tmp_arr, size_of_element, left, right, cmp_func_ptr);
+        control_report(control, count * count_merge_levels(count));
+        return;
+    }
+    size_t middle = left + (right - left) / 2;
+    internal_merge_sort_control(arr, tmp_arr, size_of_element, left, middle, cmp_func_ptr, control);
+    internal_merge_sort_control(arr, tmp_arr, size_of_element, middle + 1, right, cmp_func_ptr, control);
+    if (control_should_stop(control))
+    {
+        return;
+    }
+    merge(arr, tmp_arr, size_of_element, left, middle, right, cmp_func_ptr);
+    control_report(control, count);
+}
+
 /* 재귀 분할 정렬 (싱글 스레드) */
-static void internal_merge_sort(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr)
+void internal_merge_sort(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr)
+{
+    sort_range(arr, tmp_arr, size_of_element, left, right, cmp_func_ptr, SORT_INSERTION_CUTOFF);
+}
+
+/* 재귀 분할 정렬 본체, insertion_cutoff 이하의 구간은 이진 삽입 정렬 (튜닝 값은 재귀마다 읽지 않고 한 번만 읽음) */
+static void sort_range(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, size_t insertion_cutoff)
 {
     if (left >= right)
     {
         return;
     }
+    if (right - left < insertion_cutoff)
+    {
+        insertion_sort_binary((char *)arr + left * size_of_element, right - left + 1, size_of_element, cmp_func_ptr);
+        return;
+    }
     size_t middle = left + (right - left) / 2;
-    internal_merge_sort(arr, tmp_arr, size_of_element, left, middle, cmp_func_ptr);
-    internal_merge_sort(arr, tmp_arr, size_of_element, middle + 1, right, cmp_func_ptr);
+    sort_range(arr, tmp_arr, size_of_element, left, middle, cmp_func_ptr, insertion_cutoff);
+    sort_range(arr, tmp_arr, size_of_element, middle + 1, right, cmp_func_ptr, insertion_cutoff);
     merge(arr, tmp_arr, size_of_element, left, middle, right, cmp_func_ptr);
 }
 
 /* 재귀 분할 정렬 (멀티 스레드) */
-static unsigned __stdcall parallel_internal_sort(void *arg)
+static SORT_THREAD_PROC parallel_internal_sort(void *arg)
 {
     ThreadArg *arg_ptr = (ThreadArg *)arg;
     if (arg_ptr->left >= arg_ptr->right)
@@ -102,9 +315,18 @@ static unsigned __stdcall parallel_internal_sort(void *arg)
         return 0;
     }
     /* 데이터가 작거나 가용 스레드가 없으면 순차 정렬로 전환 */
-    if (arg_ptr->num_threads <= 1 || arg_ptr->right - arg_ptr->left < THRESHOLD)
+    if (arg_ptr->num_threads <= 1 || arg_ptr->right - arg_ptr->left < SORT_PARALLEL_THRESHOLD)
     {
-        internal_merge_sort(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr);
+        SORT_TRACE_START(leaf_start);
+        if (arg_ptr->control != NULL)
+        {
+            internal_merge_sort_control(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr, arg_ptr->control);
+        }
+        else
+        {
+            internal_merge_sort(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr);
+        }
+        SORT_TRACE_STOP(leaf_start, "leaf sort", arg_ptr->right - arg_ptr->left + 1);
         return 0;
     }
 
@@ -112,22 +334,37 @@ static unsigned __stdcall parallel_internal_sort(void *arg)
     int left_threads = arg_ptr->num_threads / 2;
     int right_threads = arg_ptr->num_threads - left_threads;
 
-    ThreadArg left_arg = {arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, middle, arg_ptr->cmp_func_ptr, left_threads};
-    ThreadArg right_arg = {arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, middle + 1, arg_ptr->right, arg_ptr->cmp_func_ptr, right_threads};
+    ThreadArg left_arg = {arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, middle, arg_ptr->cmp_func_ptr, left_threads, arg_ptr->control};
+    ThreadArg right_arg = {arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, middle + 1, arg_ptr->right, arg_ptr->cmp_func_ptr, right_threads, arg_ptr->control};
 
-    HANDLE hThread = (HANDLE)_beginthreadex(NULL, 0, parallel_internal_sort, &left_arg, 0, NULL);
+    SortThread thread;
+    SORT_TRACE_START(spawn_start);
+    int is_spawned = (sort_thread_create(&thread, parallel_internal_sort, &left_arg) == 0);
+    SORT_TRACE_STOP(spawn_start, "spawn", middle - arg_ptr->left + 1);
     parallel_internal_sort(&right_arg); // 오른쪽은 현재 스레드에서 처리
-    if (SORT_LIKELY(hThread != 0))
+    if (SORT_LIKELY(is_spawned))
     {
-        WaitForSingleObject(hThread, INFINITE);
-        CloseHandle(hThread);
+        SORT_TRACE_START(join_start);
+        sort_thread_join(thread);
+        SORT_TRACE_STOP(join_start, "join", middle - arg_ptr->left + 1);
     }
     else
     {
         /* 스레드 생성 실패 시 현재 스레드에서 순차 처리 */
-        internal_merge_sort(left_arg.arr, left_arg.tmp_arr, left_arg.size_of_element, left_arg.left, left_arg.right, left_arg.cmp_func_ptr);
+        left_arg.num_threads = 1;
+        parallel_internal_sort(&left_arg);
+    }
+    if (arg_ptr->control != NULL && control_should_stop(arg_ptr->control))
+    {
+        return 0;
     }
+    SORT_TRACE_START(merge_start);
     merge(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, middle, arg_ptr->right, arg_ptr->cmp_func_ptr);
+    SORT_TRACE_STOP(merge_start, "merge", arg_ptr->right - arg_ptr->left + 1);
+    if (arg_ptr->control != NULL)
+    {
+        control_report(arg_ptr->control, arg_ptr->right - arg_ptr->left + 1);
+    }
     return 0;
 }
 
@@ -144,17 +381,17 @@ static void merge_to_buffer(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, s
 
     while (SORT_LIKELY(ptr_left <= ptr_left_end && ptr_right <= ptr_right_end))
     {
-        if ((*cmp_func_ptr)(ptr_left, ptr_right) <= 0)
+        if (sort_compare(cmp_func_ptr, ptr_left, ptr_right) <= 0)
         {
             char *ptr_start = ptr_left;
             /* 연속된 구간 탐색 */
             do
             {
                 ptr_left += size_of_element;
-            } while (SORT_LIKELY(ptr_left <= ptr_left_end) && (*cmp_func_ptr)(ptr_left, ptr_right) <= 0);
+            } while (SORT_LIKELY(ptr_left <= ptr_left_end) && sort_compare(cmp_func_ptr, ptr_left, ptr_right) <= 0);
 
             size_t bytes = ptr_left - ptr_start;
-            memcpy(ptr_dest, ptr_start, bytes);
+            sort_memcpy(ptr_dest, ptr_start, bytes);
             ptr_dest += bytes;
         }
         else
@@ -163,10 +400,10 @@ static void merge_to_buffer(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, s
             do
             {
                 ptr_right += size_of_element;
-            } while (SORT_LIKELY(ptr_right <= ptr_right_end) && (*cmp_func_ptr)(ptr_left, ptr_right) > 0);
+            } while (SORT_LIKELY(ptr_right <= ptr_right_end) && sort_compare(cmp_func_ptr, ptr_left, ptr_right) > 0);
 
             size_t bytes = ptr_right - ptr_start;
-            memcpy(ptr_dest, ptr_start, bytes);
+            sort_memcpy(ptr_dest, ptr_start, bytes);
             ptr_dest += bytes;
         }
     }
@@ -174,12 +411,12 @@ static void merge_to_buffer(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, s
     if (ptr_left > ptr_left_end)
     {
         size_t bytes_remaining = ptr_right_end - ptr_right + size_of_element;
-        memcpy(ptr_dest, ptr_right, bytes_remaining);
+        sort_memcpy(ptr_dest, ptr_right, bytes_remaining);
     }
     else
     {
         size_t bytes_remaining = ptr_left_end - ptr_left + size_of_element;
-        memcpy(ptr_dest, ptr_left, bytes_remaining);
+        sort_memcpy(ptr_dest, ptr_left, bytes_remaining);
     }
 }
 
@@ -187,7 +424,7 @@ static void merge_to_buffer(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, s
 static inline void merge(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t middle, size_t right, CmpFunc cmp_func_ptr)
 {
     merge_to_buffer(tmp_arr, arr, size_of_element, left, middle, right, cmp_func_ptr);
-    memcpy((char *)arr + (size_of_element * left), (char *)tmp_arr + (size_of_element * left), size_of_element * (right - left + 1));
+    sort_memcpy((char *)arr + (size_of_element * left), (char *)tmp_arr + (size_of_element * left), size_of_element * (right - left + 1));
 }
 
 /* --- Ping-Pong (더블 버퍼링) 구현 --- */
@@ -204,9 +441,9 @@ typedef struct ThreadArgPPStruct
     int num_threads;
 } ThreadArgPP;
 
-static void internal_sort_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr);
+static void internal_sort_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, size_t insertion_cutoff);
 static inline void merge_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t middle, size_t right, CmpFunc cmp_func_ptr);
-static unsigned __stdcall parallel_internal_sort_pp(void *arg);
+static SORT_THREAD_PROC parallel_internal_sort_pp(void *arg);
 
 /* [공개 함수] 더블 버퍼링 기반 멀티 스레드 병합 정렬 */
 int merge_sort_pp(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
@@ -215,20 +452,25 @@ int merge_sort_pp(void *arr, size_t num_of_elements, size_t size_of_element, int
     {
         return 0;
     }
-    void *src = malloc(num_of_elements * size_of_element);
+    SORT_TRACE_START(alloc_start);
+    void *src = sort_malloc(num_of_elements * size_of_element);
+    SORT_TRACE_STOP(alloc_start, "alloc", num_of_elements);
     if (SORT_UNLIKELY(src == NULL))
     {
         return -1;
     }
     /* Ping-Pong 로직을 위한 초기 데이터 복사본 생성 */
-    memcpy(src, arr, num_of_elements * size_of_element);
+    SORT_TRACE_START(copy_start);
+    sort_memcpy(src, arr, num_of_elements * size_of_element);
+    SORT_TRACE_STOP(copy_start, "copy", num_of_elements);
 
-    int sys_cpu_count = get_thread_count();
-    int cpu_count = (sys_cpu_count >= 8) ? sys_cpu_count - 2 : ((sys_cpu_count >= 4) ? sys_cpu_count - 1 : sys_cpu_count);
+    int cpu_count = sort_worker_count();
 
     ThreadArgPP initial_arg = {arr, src, size_of_element, 0, num_of_elements - 1, cmp_func_ptr, cpu_count};
     parallel_internal_sort_pp(&initial_arg);
-    free(src);
+    SORT_TRACE_START(free_start);
+    sort_free(src);
+    SORT_TRACE_STOP(free_start, "free", num_of_elements);
     return 0;
 }
 
@@ -236,16 +478,22 @@ int merge_sort_pp(void *arr, size_t num_of_elements, size_t size_of_element, int
  * 재귀 분할 정렬 (Ping-Pong, 멀티스레드)
  * 재귀 깊이에 따라 src와 dest 역할을 교대
  */
-static void internal_sort_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr)
+static void internal_sort_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, size_t insertion_cutoff)
 {
     if (left >= right)
     {
         return;
     }
+    if (right - left < insertion_cutoff)
+    {
+        /* 아직 병합되지 않은 구간은 두 버퍼의 내용이 같으므로 dest에서 바로 정렬 */
+        insertion_sort_binary((char *)dest + left * size_of_element, right - left + 1, size_of_element, cmp_func_ptr);
+        return;
+    }
     size_t middle = left + (right - left) / 2;
     /* 다음 단계에서는 src와 dest의 역할을 바꿔 호출 */
-    internal_sort_pp(src, dest, size_of_element, left, middle, cmp_func_ptr);
-    internal_sort_pp(src, dest, size_of_element, middle + 1, right, cmp_func_ptr);
+    internal_sort_pp(src, dest, size_of_element, left, middle, cmp_func_ptr, insertion_cutoff);
+    internal_sort_pp(src, dest, size_of_element, middle + 1, right, cmp_func_ptr, insertion_cutoff);
     merge_pp(dest, src, size_of_element, left, middle, right, cmp_func_ptr);
 }
 
@@ -255,16 +503,18 @@ static inline void merge_pp(void *SORT_RESTRICT dest, void *SORT_RESTRICT src, s
     merge_to_buffer(dest, src, size_of_element, left, middle, right, cmp_func_ptr);
 }
 
-static unsigned __stdcall parallel_internal_sort_pp(void *arg)
+static SORT_THREAD_PROC parallel_internal_sort_pp(void *arg)
 {
     ThreadArgPP *arg_ptr = (ThreadArgPP *)arg;
     if (arg_ptr->left >= arg_ptr->right)
     {
         return 0;
     }
-    if (arg_ptr->num_threads <= 1 || arg_ptr->right - arg_ptr->left < THRESHOLD)
+    if (arg_ptr->num_threads <= 1 || arg_ptr->right - arg_ptr->left < SORT_PARALLEL_THRESHOLD)
     {
-        internal_sort_pp(arg_ptr->dest, arg_ptr->src, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr);
+        SORT_TRACE_START(leaf_start);
+        internal_sort_pp(arg_ptr->dest, arg_ptr->src, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr, SORT_INSERTION_CUTOFF);
+        SORT_TRACE_STOP(leaf_start, "leaf sort", arg_ptr->right - arg_ptr->left + 1);
         return 0;
     }
 
@@ -276,17 +526,25 @@ static unsigned __stdcall parallel_internal_sort_pp(void *arg)
     ThreadArgPP left_arg = {arg_ptr->src, arg_ptr->dest, arg_ptr->size_of_element, arg_ptr->left, middle, arg_ptr->cmp_func_ptr, left_threads};
     ThreadArgPP right_arg = {arg_ptr->src, arg_ptr->dest, arg_ptr->size_of_element, middle + 1, arg_ptr->right, arg_ptr->cmp_func_ptr, right_threads};
 
-    HANDLE hThread = (HANDLE)_beginthreadex(NULL, 0, parallel_internal_sort_pp, &left_arg, 0, NULL);
+    SortThread thread;
+    SORT_TRACE_START(spawn_start);
+    int is_spawned = (sort_thread_create(&thread, parallel_internal_sort_pp, &left_arg) == 0);
+    SORT_TRACE_STOP(spawn_start, "spawn", middle - arg_ptr->left + 1);
     parallel_internal_sort_pp(&right_arg);
-    if (SORT_LIKELY(hThread != 0))
+    if (SORT_LIKELY(is_spawned))
     {
-        WaitForSingleObject(hThread, INFINITE);
-        CloseHandle(hThread);
+        SORT_TRACE_START(join_start);
+        sort_thread_join(thread);
+        SORT_TRACE_STOP(join_start, "join", middle - arg_ptr->left + 1);
     }
     else
     {
-        internal_sort_pp(left_arg.dest, left_arg.src, left_arg.size_of_element, left_arg.left, left_arg.right, left_arg.cmp_func_ptr);
+        SORT_TRACE_START(leaf_start);
+        internal_sort_pp(left_arg.dest, left_arg.src, left_arg.size_of_element, left_arg.left, left_arg.right, left_arg.cmp_func_ptr, SORT_INSERTION_CUTOFF);
+        SORT_TRACE_STOP(leaf_start, "leaf sort", middle - arg_ptr->left + 1);
     }
+    SORT_TRACE_START(merge_start);
     merge_pp(arg_ptr->dest, arg_ptr->src, arg_ptr->size_of_element, arg_ptr->left, middle, arg_ptr->right, arg_ptr->cmp_func_ptr);
+    SORT_TRACE_STOP(merge_start, "merge", arg_ptr->right - arg_ptr->left + 1);
     return 0;
 }
@@ -0,0 +1,423 @@
+/**
+ * @file nth_element.c
+ * @brief 순서 통계량 선택 구현부 (Introselect, Multi-rank, Multi-thread)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수 이하의 구간은 이진 삽입 정렬로 바로 처리 */
+#define SELECT_INSERTION_LIMIT 16
+
+/* 멀티스레드 분할 인자 전달용 구조체 */
+typedef struct SelectArgStruct
+{
+    char *src;
+    char *dest;
+    size_t size_of_element;
+    size_t begin;
+    size_t end;
+    const void *pivot;
+    CmpFunc cmp_func_ptr;
+    size_t num_less;
+    size_t num_equal;
+    size_t less_pos;
+    size_t equal_pos;
+    size_t greater_pos;
+} SelectArg;
+
+static void introselect(char *arr, size_t left, size_t right, size_t nth, size_t size_of_element, CmpFunc cmp_func_ptr, int depth_limit);
+static void multiselect(char *arr, size_t left, size_t right, const size_t *ranks, size_t num_ranks, size_t size_of_element, CmpFunc cmp_func_ptr, int depth_limit);
+static void partition3(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *lt_out, size_t *gt_out);
+static void choose_pivot(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr);
+static void median_of_medians_pivot(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr);
+static inline char *median_of_three(char *a_ptr, char *b_ptr, char *c_ptr, CmpFunc cmp_func_ptr);
+static int get_depth_limit(size_t num_of_elements);
+static SORT_THREAD_PROC count_chunk(void *arg);
+static SORT_THREAD_PROC scatter_chunk(void *arg);
+static SORT_THREAD_PROC copy_back_chunk(void *arg);
+
+/* [공개 함수] n번째 원소 선택 */
+void nth_element(void *arr, size_t num_of_elements, size_t nth, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0 || nth >= num_of_elements))
+    {
+        return;
+    }
+    introselect((char *)arr, 0, num_of_elements - 1, nth, size_of_element, cmp_func_ptr, get_depth_limit(num_of_elements));
+}
+
+/* [공개 함수] 여러 순위를 한 번에 선택 */
+void nth_element_ranks(void *arr, size_t num_of_elements, const size_t *ranks, size_t num_ranks, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0 || ranks == NULL))
+    {
+        return;
+    }
+    /* 오름차순이므로 범위를 벗어난 순위는 끝에 몰려 있음 */
+    while (num_ranks > 0 && ranks[num_ranks - 1] >= num_of_elements)
+    {
+        num_ranks--;
+    }
+    if (num_ranks == 0)
+    {
+        return;
+    }
+    multiselect((char *)arr, 0, num_of_elements - 1, ranks, num_ranks, size_of_element, cmp_func_ptr, get_depth_limit(num_of_elements));
+}
+
+/* [공개 함수] 멀티 스레드 n번째 원소 선택 */
+int nth_element_multi(void *arr, size_t num_of_elements, size_t nth, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0 || nth >= num_of_elements))
+    {
+        return 0;
+    }
+
+    int cpu_count = sort_worker_count();
+    if (cpu_count <= 1 || num_of_elements < 2 * SORT_PARALLEL_THRESHOLD)
+    {
+        nth_element(arr, num_of_elements, nth, size_of_element, cmp_func_ptr);
+        return 0;
+    }
+
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    void *pivot = sort_malloc(size_of_element);
+    SelectArg *args = (SelectArg *)sort_malloc(cpu_count * sizeof(SelectArg));
+    if (SORT_UNLIKELY(tmp_arr == NULL || pivot == NULL || args == NULL))
+    {
+        sort_free(tmp_arr);
+        sort_free(pivot);
+        sort_free(args);
+        return -1;
+    }
+
+    char *base = (char *)arr;
+    size_t left = 0;
+    size_t right = num_of_elements - 1;
+    int rounds_left = get_depth_limit(num_of_elements);
+    int is_found = 0;
+
+    while (!is_found && right - left + 1 >= 2 * SORT_PARALLEL_THRESHOLD && rounds_left-- > 0)
+    {
+        size_t count = right - left + 1;
+        /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+        int num_workers = (count / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(count / SORT_PARALLEL_THRESHOLD) : cpu_count;
+        size_t chunk = count / num_workers;
+
+        /* 분할 도중 원소가 이동하므로 피벗은 별도 버퍼에 복사해 둠 */
+        choose_pivot(base, left, right, size_of_element, cmp_func_ptr);
+        sort_memcpy(pivot, base + left * size_of_element, size_of_element);
+
+        for (int t = 0; t < num_workers; t++)
+        {
+            SelectArg *arg_ptr = &args[t];
+            arg_ptr->src = base;
+            arg_ptr->dest = (char *)tmp_arr;
+            arg_ptr->size_of_element = size_of_element;
+            arg_ptr->begin = left + t * chunk;
+            arg_ptr->end = (t == num_workers - 1) ? right + 1 : left + (t + 1) * chunk;
+            arg_ptr->pivot = pivot;
+            arg_ptr->cmp_func_ptr = cmp_func_ptr;
+        }
+        sort_run_workers(count_chunk, args, sizeof(SelectArg), num_workers);
+
+        /* 각 스레드가 쓸 위치를 누적합으로 계산 */
+        size_t total_less = 0;
+        size_t total_equal = 0;
+        for (int t = 0; t < num_workers; t++)
+        {
+            total_less += args[t].num_less;
+            total_equal += args[t].num_equal;
+        }
+        size_t less_pos = left;
+        size_t equal_pos = left + total_less;
+        size_t greater_pos = left + total_less + total_equal;
+        for (int t = 0; t < num_workers; t++)
+        {
+            size_t num_greater = (args[t].end - args[t].begin) - args[t].num_less - args[t].num_equal;
+            args[t].less_pos = less_pos;
+            args[t].equal_pos = equal_pos;
+            args[t].greater_pos = greater_pos;
+            less_pos += args[t].num_less;
+            equal_pos += args[t].num_equal;
+            greater_pos += num_greater;
+        }
+        sort_run_workers(scatter_chunk, args, sizeof(SelectArg), num_workers);
+        sort_run_workers(copy_back_chunk, args, sizeof(SelectArg), num_workers);
+
+        size_t equal_begin = left + total_less;
+        size_t equal_end = equal_begin + total_equal; // 피벗 자신이 포함되므로 항상 1 이상
+        if (nth < equal_begin)
+        {
+            right = equal_begin - 1;
+        }
+        else if (nth >= equal_end)
+        {
+            left = equal_end;
+        }
+        else
+        {
+            is_found = 1;
+        }
+    }
+
+    if (!is_found)
+    {
+        /* 남은 구간이 작아지면 순차 선택으로 전환 */
+        introselect(base, left, right, nth, size_of_element, cmp_func_ptr, get_depth_limit(right - left + 1));
+    }
+
+    sort_free(args);
+    sort_free(pivot);
+    sort_free(tmp_arr);
+    return 0;
+}
+
+/* 반복형 introselect, 분할이 계속 치우치면 median-of-medians로 피벗을 골라 선형 시간을 보장 */
+static void introselect(char *arr, size_t left, size_t right, size_t nth, size_t size_of_element, CmpFunc cmp_func_ptr, int depth_limit)
+{
+    while (right > left)
+    {
+        if (right - left + 1 <= SELECT_INSERTION_LIMIT)
+        {
+            insertion_sort_binary(arr + left * size_of_element, right - left + 1, size_of_element, cmp_func_ptr);
+            return;
+        }
+        if (depth_limit-- <= 0)
+        {
+            median_of_medians_pivot(arr, left, right, size_of_element, cmp_func_ptr);
+        }
+        else
+        {
+            choose_pivot(arr, left, right, size_of_element, cmp_func_ptr);
+        }
+
+        size_t lt, gt;
+        partition3(arr, left, right, size_of_element, cmp_func_ptr, &lt, &gt);
+        if (nth < lt)
+        {
+            right = lt - 1;
+        }
+        else if (nth > gt)
+        {
+            left = gt + 1;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+/* 한 번 분할할 때마다 오름차순 순위 목록을 양쪽으로 나눠 필요한 쪽만 계속 선택 */
+static void multiselect(char *arr, size_t left, size_t right, const size_t *ranks, size_t num_ranks, size_t size_of_element, CmpFunc cmp_func_ptr, int depth_limit)
+{
+    while (num_ranks > 0 && right > left)
+    {
+        if (right - left + 1 <= SELECT_INSERTION_LIMIT)
+        {
+            insertion_sort_binary(arr + left * size_of_element, right - left + 1, size_of_element, cmp_func_ptr);
+            return;
+        }
+        if (depth_limit-- <= 0)
+        {
+            median_of_medians_pivot(arr, left, right, size_of_element, cmp_func_ptr);
+        }
+        else
+        {
+            choose_pivot(arr, left, right, size_of_element, cmp_func_ptr);
+        }
+
+        size_t lt, gt;
+        partition3(arr, left, right, size_of_element, cmp_func_ptr, &lt, &gt);
+
+        size_t lo_count = 0;
+        while (lo_count < num_ranks && ranks[lo_count] < lt)
+        {
+            lo_count++;
+        }
+        size_t hi_start = lo_count;
+        while (hi_start < num_ranks && ranks[hi_start] <= gt)
+        {
+            hi_start++;
+        }
+
+        if (lo_count > 0)
+        {
+            multiselect(arr, left, lt - 1, ranks, lo_count, size_of_element, cmp_func_ptr, depth_limit);
+        }
+        /* 오른쪽 구간은 반복으로 처리하여 재귀 깊이를 줄임 */
+        ranks += hi_start;
+        num_ranks -= hi_start;
+        left = gt + 1;
+    }
+}
+
+/**
+ * 3-way (Dutch flag) 분할, 피벗은 arr[left]에 있어야 함
+ * 결과: [left, lt) < 피벗, [lt, gt] == 피벗, (gt, right] > 피벗
+ * [lt, i) 구간은 항상 피벗과 같으므로 피벗 복사본 없이 arr[lt]와 비교함
+ */
+static void partition3(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr, size_t *lt_out, size_t *gt_out)
+{
+    size_t lt = left;
+    size_t i = left + 1;
+    size_t gt = right;
+
+    while (i <= gt)
+    {
+        char *current = arr + i * size_of_element;
+        int result = sort_compare(cmp_func_ptr, current, arr + lt * size_of_element);
+        if (result < 0)
+        {
+            generic_swap(arr + lt * size_of_element, current, size_of_element);
+            lt++;
+            i++;
+        }
+        else if (result > 0)
+        {
+            generic_swap(current, arr + gt * size_of_element, size_of_element);
+            gt--;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    *lt_out = lt;
+    *gt_out = gt;
+}
+
+/* 세 원소 중 중앙값의 포인터 반환 */
+static inline char *median_of_three(char *a_ptr, char *b_ptr, char *c_ptr, CmpFunc cmp_func_ptr)
+{
+    if (sort_compare(cmp_func_ptr, a_ptr, b_ptr) < 0)
+    {
+        if (sort_compare(cmp_func_ptr, b_ptr, c_ptr) < 0)
+        {
+            return b_ptr;
+        }
+        return (sort_compare(cmp_func_ptr, a_ptr, c_ptr) < 0) ? c_ptr : a_ptr;
+    }
+    if (sort_compare(cmp_func_ptr, a_ptr, c_ptr) < 0)
+    {
+        return a_ptr;
+    }
+    return (sort_compare(cmp_func_ptr, b_ptr, c_ptr) < 0) ? c_ptr : b_ptr;
+}
+
+/* median-of-3 (큰 구간은 ninther)로 피벗을 골라 arr[left]로 이동 */
+static void choose_pivot(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr)
+{
+    size_t count = right - left + 1;
+    size_t middle = left + count / 2;
+    char *pivot_ptr;
+
+    if (count > 128)
+    {
+        size_t step = count / 8;
+        char *m1 = median_of_three(arr + left * size_of_element, arr + (left + step) * size_of_element, arr + (left + 2 * step) * size_of_element, cmp_func_ptr);
+        char *m2 = median_of_three(arr + (middle - step) * size_of_element, arr + middle * size_of_element, arr + (middle + step) * size_of_element, cmp_func_ptr);
+        char *m3 = median_of_three(arr + (right - 2 * step) * size_of_element, arr + (right - step) * size_of_element, arr + right * size_of_element, cmp_func_ptr);
+        pivot_ptr = median_of_three(m1, m2, m3, cmp_func_ptr);
+    }
+    else
+    {
+        pivot_ptr = median_of_three(arr + left * size_of_element, arr + middle * size_of_element, arr + right * size_of_element, cmp_func_ptr);
+    }
+    generic_swap(arr + left * size_of_element, pivot_ptr, size_of_element);
+}
+
+/* 5개씩 묶은 그룹의 중앙값들의 중앙값을 피벗으로 골라 arr[left]로 이동 */
+static void median_of_medians_pivot(char *arr, size_t left, size_t right, size_t size_of_element, CmpFunc cmp_func_ptr)
+{
+    size_t num_groups = 0;
+    for (size_t start = left; start <= right; start += 5)
+    {
+        size_t count = (right - start + 1 < 5) ? right - start + 1 : 5;
+        insertion_sort_binary(arr + start * size_of_element, count, size_of_element, cmp_func_ptr);
+        /* 그룹 중앙값을 구간 앞쪽으로 모음 */
+        generic_swap(arr + (left + num_groups) * size_of_element, arr + (start + (count - 1) / 2) * size_of_element, size_of_element);
+        num_groups++;
+    }
+    size_t median = left + (num_groups - 1) / 2;
+    /* depth_limit 0으로 호출하여 재귀 선택도 median-of-medians를 사용 */
+    introselect(arr, left, left + num_groups - 1, median, size_of_element, cmp_func_ptr, 0);
+    generic_swap(arr + left * size_of_element, arr + median * size_of_element, size_of_element);
+}
+
+/* 치우친 분할을 허용할 횟수 (2 * log2(n)) */
+static int get_depth_limit(size_t num_of_elements)
+{
+    int depth = 0;
+    while (num_of_elements > 1)
+    {
+        num_of_elements >>= 1;
+        depth++;
+    }
+    return depth * 2;
+}
+
+/* 1단계: 담당 구간에서 피벗보다 작은/같은 원소 수 세기 */
+static SORT_THREAD_PROC count_chunk(void *arg)
+{
+    SelectArg *arg_ptr = (SelectArg *)arg;
+    size_t num_less = 0;
+    size_t num_equal = 0;
+    char *current = arg_ptr->src + arg_ptr->begin * arg_ptr->size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        int result = sort_compare(arg_ptr->cmp_func_ptr, current, arg_ptr->pivot);
+        num_less += (result < 0);
+        num_equal += (result == 0);
+        current += arg_ptr->size_of_element;
+    }
+    arg_ptr->num_less = num_less;
+    arg_ptr->num_equal = num_equal;
+    return 0;
+}
+
+/* 2단계: 누적합으로 정해진 위치에 원소를 흩뿌림 */
+static SORT_THREAD_PROC scatter_chunk(void *arg)
+{
+    SelectArg *arg_ptr = (SelectArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    char *less_ptr = arg_ptr->dest + arg_ptr->less_pos * size_of_element;
+    char *equal_ptr = arg_ptr->dest + arg_ptr->equal_pos * size_of_element;
+    char *greater_ptr = arg_ptr->dest + arg_ptr->greater_pos * size_of_element;
+    char *current = arg_ptr->src + arg_ptr->begin * size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        int result = sort_compare(arg_ptr->cmp_func_ptr, current, arg_ptr->pivot);
+        if (result < 0)
+        {
+            sort_memcpy(less_ptr, current, size_of_element);
+            less_ptr += size_of_element;
+        }
+        else if (result == 0)
+        {
+            sort_memcpy(equal_ptr, current, size_of_element);
+            equal_ptr += size_of_element;
+        }
+        else
+        {
+            sort_memcpy(greater_ptr, current, size_of_element);
+            greater_ptr += size_of_element;
+        }
+        current += size_of_element;
+    }
+    return 0;
+}
+
+/* 3단계: 분할 결과를 원본 배열로 복사 */
+static SORT_THREAD_PROC copy_back_chunk(void *arg)
+{
+    SelectArg *arg_ptr = (SelectArg *)arg;
+    size_t offset = arg_ptr->begin * arg_ptr->size_of_element;
+    sort_memcpy(arg_ptr->src + offset, arg_ptr->dest + offset, (arg_ptr->end - arg_ptr->begin) * arg_ptr->size_of_element);
+    return 0;
+}
+
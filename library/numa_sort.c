@@ -0,0 +1,543 @@
+/**
+ * @file numa_sort.c
+ * @brief NUMA 인지 멀티 스레드 병합 정렬 구현부
+ *
+ * 노드마다 대표 스레드를 해당 노드의 CPU에 고정하고, 배열 조각을 노드 로컬 버퍼로 복사하여 노드 안에서 정렬한 뒤
+ * 모든 노드의 스레드가 출력 구간을 나눠 맡아 노드 간 병합을 수행 (출력 구간은 그 페이지를 가진 노드가 맡음)
+ * 작업 0번은 호출한 스레드에서 실행되므로, 고정한 스레드는 작업이 끝나면 원래 CPU 친화도로 되돌림
+ *
+ * 토폴로지는 SORT_USE_LIBNUMA가 정의되면 libnuma로, 아니면 Linux sysfs 또는 Win32 API로 조회
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+#if defined(SORT_USE_LIBNUMA)
+    #include <numa.h>
+#endif
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+/* sysfs 노드 디렉터리 (테스트 등에서 다른 경로로 바꿀 수 있음) */
+#ifndef SORT_NUMA_SYSFS_ROOT
+    #define SORT_NUMA_SYSFS_ROOT "/sys/devices/system/node"
+#endif
+
+#define NUMA_MAX_NODES 64
+#define NUMA_MAX_CPUS 4096
+/* first-touch 시 페이지마다 한 바이트씩 기록할 간격 */
+#define NUMA_PAGE_SIZE 4096
+
+/* 노드 번호와 해당 노드에 속한 CPU 목록 */
+typedef struct NumaNodeStruct
+{
+    int id;
+    int *cpus;
+    int num_cpus;
+} NumaNode;
+
+/* 고정하기 전의 CPU 친화도 */
+typedef struct NumaAffinityStruct
+{
+    int is_saved;
+#if defined(_WIN32)
+    DWORD_PTR mask;
+#elif defined(__linux__)
+    cpu_set_t set;
+#endif
+} NumaAffinity;
+
+/* 노드별 정렬 인자 전달용 구조체 */
+typedef struct NumaSortArgStruct
+{
+    char *arr;
+    char *buf;
+    char *tmp_arr;
+    size_t size_of_element;
+    size_t left;
+    size_t right;
+    CmpFunc cmp_func_ptr;
+    const NumaNode *node;
+    int num_threads;
+} NumaSortArg;
+
+/* 노드 간 병합 인자 전달용 구조체, 두 런을 병합한 결과 중 [out_begin, out_end) 구간을 담당 */
+typedef struct NumaMergeArgStruct
+{
+    char *dest;
+    const char *a_run;
+    size_t num_a;
+    const char *b_run;
+    size_t num_b;
+    size_t out_begin;
+    size_t out_end;
+    size_t size_of_element;
+    CmpFunc cmp_func_ptr;
+    const NumaNode *node;
+} NumaMergeArg;
+
+static int detect_topology(NumaNode *nodes, int max_nodes);
+static int add_node(NumaNode *node, int id, const int *cpus, int num_cpus);
+static void free_topology(NumaNode *nodes, int num_nodes);
+#if !defined(_WIN32)
+static int parse_cpu_list(const char *text, int *cpus, int max_cpus);
+#endif
+static void pin_to_node(const NumaNode *node, NumaAffinity *saved);
+static void restore_affinity(const NumaAffinity *saved);
+static void first_touch(char *ptr, size_t bytes);
+static SORT_THREAD_PROC sort_node_slice(void *arg);
+static int merge_node_runs(char *arr, char *buf, char *tmp_arr, const size_t *node_bounds, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const NumaNode *nodes, int num_nodes);
+static size_t co_rank(size_t out_pos, const char *a_run, size_t num_a, const char *b_run, size_t num_b, size_t size_of_element, CmpFunc cmp_func_ptr);
+static SORT_THREAD_PROC merge_piece(void *arg);
+
+/* [공개 함수] NUMA 인지 멀티 스레드 병합 정렬 */
+int merge_sort_numa(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    NumaNode nodes[NUMA_MAX_NODES];
+    int num_nodes = detect_topology(nodes, NUMA_MAX_NODES);
+    /*
+     * 노드가 하나뿐이거나 노드당 데이터가 적으면 일반 멀티 스레드 정렬로 처리
+     * 노드마다 스레드가 하나씩 동시에 실행되므로 작업 스레드 수(sort_set_thread_count)가 노드 수보다 적을 때도 마찬가지
+     */
+    if (num_nodes <= 1 || num_nodes > sort_worker_count() || num_of_elements / num_nodes < SORT_PARALLEL_THRESHOLD)
+    {
+        free_topology(nodes, num_nodes);
+        return merge_sort_multi(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+
+    /* 할당만 하고 건드리지 않아, 각 노드의 스레드가 처음 쓰는 순간 해당 노드에 페이지가 배치되도록 함 */
+    char *buf = (char *)sort_malloc(num_of_elements * size_of_element);
+    char *tmp_arr = (char *)sort_malloc(num_of_elements * size_of_element);
+    NumaSortArg *args = (NumaSortArg *)sort_malloc(num_nodes * sizeof(NumaSortArg));
+    size_t *bounds = (size_t *)sort_malloc((num_nodes + 1) * sizeof(size_t));
+    if (SORT_UNLIKELY(buf == NULL || tmp_arr == NULL || args == NULL || bounds == NULL))
+    {
+        sort_free(buf);
+        sort_free(tmp_arr);
+        sort_free(args);
+        sort_free(bounds);
+        free_topology(nodes, num_nodes);
+        return -1;
+    }
+
+    /* 노드의 CPU 수에 비례하여 조각 크기와 스레드 수를 나눔 */
+    int total_cpus = 0;
+    for (int k = 0; k < num_nodes; k++)
+    {
+        total_cpus += nodes[k].num_cpus;
+    }
+    int worker_count = sort_worker_count();
+    size_t begin = 0;
+    for (int k = 0; k < num_nodes; k++)
+    {
+        size_t count = (k == num_nodes - 1) ? num_of_elements - begin : (size_t)((double)num_of_elements * nodes[k].num_cpus / total_cpus);
+        /* 노드마다 한 스레드를 주고 나머지를 CPU 수에 비례하여 나눠, 합이 worker_count를 넘지 않게 함 */
+        int num_threads = 1 + (worker_count - num_nodes) * nodes[k].num_cpus / total_cpus;
+        NumaSortArg node_arg = {(char *)arr, buf, tmp_arr, size_of_element, begin, begin + count - 1, cmp_func_ptr, &nodes[k], num_threads};
+        args[k] = node_arg;
+        bounds[k] = begin;
+        begin += count;
+    }
+    bounds[num_nodes] = num_of_elements;
+
+    sort_run_workers(sort_node_slice, args, sizeof(NumaSortArg), num_nodes);
+    int result = merge_node_runs((char *)arr, buf, tmp_arr, bounds, num_of_elements, size_of_element, cmp_func_ptr, nodes, num_nodes);
+
+    sort_free(bounds);
+    sort_free(args);
+    sort_free(tmp_arr);
+    sort_free(buf);
+    free_topology(nodes, num_nodes);
+    return result;
+}
+
+/* CPU가 있는 노드 목록을 채우고 노드 수를 반환 (조회할 수 없으면 0) */
+static int detect_topology(NumaNode *nodes, int max_nodes)
+{
+    int num_nodes = 0;
+    int *cpus = (int *)sort_malloc(NUMA_MAX_CPUS * sizeof(int));
+    if (SORT_UNLIKELY(cpus == NULL))
+    {
+        return 0;
+    }
+
+#if defined(SORT_USE_LIBNUMA)
+    if (numa_available() >= 0)
+    {
+        struct bitmask *mask = numa_allocate_cpumask();
+        int max_node = numa_max_node();
+        for (int node = 0; node <= max_node && num_nodes < max_nodes; node++)
+        {
+            if (numa_node_to_cpus(node, mask) != 0)
+            {
+                continue;
+            }
+            int count = 0;
+            for (unsigned int cpu = 0; cpu < mask->size && count < NUMA_MAX_CPUS; cpu++)
+            {
+                if (numa_bitmask_isbitset(mask, cpu))
+                {
+                    cpus[count++] = (int)cpu;
+                }
+            }
+            num_nodes += add_node(&nodes[num_nodes], node, cpus, count);
+        }
+        numa_free_cpumask(mask);
+        sort_free(cpus);
+        return num_nodes;
+    }
+#endif
+
+#if defined(_WIN32)
+    ULONG highest_node;
+    if (GetNumaHighestNodeNumber(&highest_node))
+    {
+        for (ULONG node = 0; node <= highest_node && num_nodes < max_nodes; node++)
+        {
+            ULONGLONG mask = 0;
+            if (!GetNumaNodeProcessorMask((UCHAR)node, &mask))
+            {
+                continue;
+            }
+            int count = 0;
+            for (int cpu = 0; cpu < 64; cpu++)
+            {
+                if (mask & (1ULL << cpu))
+                {
+                    cpus[count++] = cpu;
+                }
+            }
+            num_nodes += add_node(&nodes[num_nodes], (int)node, cpus, count);
+        }
+    }
+#else
+    /* libnuma가 없으면 sysfs의 nodeN/cpulist ("0-3,8-11" 형식)를 읽음 */
+    char path[256];
+    char line[4096];
+    for (int node = 0; node < NUMA_MAX_NODES && num_nodes < max_nodes; node++)
+    {
+        snprintf(path, sizeof(path), "%s/node%d/cpulist", SORT_NUMA_SYSFS_ROOT, node);
+        FILE *file = fopen(path, "r");
+        if (file == NULL)
+        {
+            continue;
+        }
+        int count = 0;
+        if (fgets(line, sizeof(line), file) != NULL)
+        {
+            count = parse_cpu_list(line, cpus, NUMA_MAX_CPUS);
+        }
+        fclose(file);
+        num_nodes += add_node(&nodes[num_nodes], node, cpus, count);
+    }
+#endif
+
+    sort_free(cpus);
+    return num_nodes;
+}
+
+/* CPU가 있는 노드이면 CPU 목록을 복사해 채우고 1을, 아니면 0을 반환 */
+static int add_node(NumaNode *node, int id, const int *cpus, int num_cpus)
+{
+    if (num_cpus <= 0)
+    {
+        return 0;
+    }
+    node->cpus = (int *)sort_malloc(num_cpus * sizeof(int));
+    if (SORT_UNLIKELY(node->cpus == NULL))
+    {
+        return 0;
+    }
+    sort_memcpy(node->cpus, cpus, num_cpus * sizeof(int));
+    node->id = id;
+    node->num_cpus = num_cpus;
+    return 1;
+}
+
+static void free_topology(NumaNode *nodes, int num_nodes)
+{
+    for (int k = 0; k < num_nodes; k++)
+    {
+        sort_free(nodes[k].cpus);
+    }
+}
+
+#if !defined(_WIN32)
+/* "0-3,8-11" 형식의 CPU 목록을 풀어 cpus에 채우고 개수를 반환 */
+static int parse_cpu_list(const char *text, int *cpus, int max_cpus)
+{
+    int count = 0;
+    const char *ptr = text;
+    while (*ptr != '\0')
+    {
+        char *end;
+        long first = strtol(ptr, &end, 10);
+        if (end == ptr)
+        {
+            break;
+        }
+        long last = first;
+        if (*end == '-')
+        {
+            ptr = end + 1;
+            last = strtol(ptr, &end, 10);
+        }
+        for (long cpu = first; cpu <= last && count < max_cpus; cpu++)
+        {
+            cpus[count++] = (int)cpu;
+        }
+        if (*end != ',')
+        {
+            break;
+        }
+        ptr = end + 1;
+    }
+    return count;
+}
+#endif
+
+/* 현재 스레드를 노드의 CPU에만 실행되도록 고정하고 이전 친화도를 saved에 저장 (실패해도 정렬 결과에는 영향 없음) */
+static void pin_to_node(const NumaNode *node, NumaAffinity *saved)
+{
+    saved->is_saved = 0;
+#if defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (int i = 0; i < node->num_cpus; i++)
+    {
+        if (node->cpus[i] < (int)(sizeof(DWORD_PTR) * 8))
+        {
+            mask |= (DWORD_PTR)1 << node->cpus[i];
+        }
+    }
+    if (mask != 0)
+    {
+        saved->mask = SetThreadAffinityMask(GetCurrentThread(), mask); // 이전 마스크, 실패하면 0
+        saved->is_saved = (saved->mask != 0);
+    }
+#elif defined(__linux__)
+    /* Linux에서는 이후 생성하는 스레드도 이 친화도를 물려받음 (numa_run_on_node도 스레드 친화도를 바꾸므로 같은 방법으로 되돌림) */
+    saved->is_saved = (sched_getaffinity(0, sizeof(saved->set), &saved->set) == 0);
+#if defined(SORT_USE_LIBNUMA)
+    if (numa_available() >= 0)
+    {
+        numa_run_on_node(node->id);
+        return;
+    }
+#endif
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int i = 0; i < node->num_cpus; i++)
+    {
+        if (node->cpus[i] < CPU_SETSIZE)
+        {
+            CPU_SET(node->cpus[i], &set);
+        }
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void)node;
+#endif
+}
+
+/* pin_to_node 이전의 친화도로 되돌림 */
+static void restore_affinity(const NumaAffinity *saved)
+{
+    if (!saved->is_saved)
+    {
+        return;
+    }
+#if defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), saved->mask);
+#elif defined(__linux__)
+    sched_setaffinity(0, sizeof(saved->set), &saved->set);
+#endif
+}
+
+/* 페이지마다 한 바이트씩 기록하여 현재 스레드의 노드에 페이지를 배치 */
+static void first_touch(char *ptr, size_t bytes)
+{
+    for (size_t offset = 0; offset < bytes; offset += NUMA_PAGE_SIZE)
+    {
+        ptr[offset] = 0;
+    }
+}
+
+/* 노드 대표 스레드: 노드에 고정 후 조각을 로컬 버퍼로 복사하고 노드의 스레드 수로 정렬 */
+static SORT_THREAD_PROC sort_node_slice(void *arg)
+{
+    NumaSortArg *arg_ptr = (NumaSortArg *)arg;
+    size_t offset = arg_ptr->left * arg_ptr->size_of_element;
+    size_t bytes = (arg_ptr->right - arg_ptr->left + 1) * arg_ptr->size_of_element;
+
+    NumaAffinity saved;
+    pin_to_node(arg_ptr->node, &saved);
+    sort_memcpy(arg_ptr->buf + offset, arg_ptr->arr + offset, bytes);
+    first_touch(arg_ptr->tmp_arr + offset, bytes);
+    internal_merge_sort_multi(arg_ptr->buf, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->left, arg_ptr->right, arg_ptr->cmp_func_ptr, arg_ptr->num_threads);
+    restore_affinity(&saved);
+    return 0;
+}
+
+/**
+ * 노드별 정렬 결과(buf의 노드 수만큼의 런)를 두 개씩 병합하는 단계를 반복하여 최종 결과를 arr에 기록
+ * buf와 tmp_arr의 [node_bounds[k], node_bounds[k + 1]) 구간은 sort_node_slice에서 노드 k가 처음 기록했으므로,
+ * 각 단계의 출력을 노드 경계에서 나누고 조각마다 그 구간을 가진 노드에 고정하여 쓰기가 항상 노드 로컬이 되게 함
+ * (마지막 단계의 출력인 arr는 페이지 위치를 알 수 없으므로 같은 구간을 읽어 간 노드가 맡음)
+ */
+static int merge_node_runs(char *arr, char *buf, char *tmp_arr, const size_t *node_bounds, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const NumaNode *nodes, int num_nodes)
+{
+    int worker_count = sort_worker_count();
+    int num_runs = num_nodes;
+    /* 한 단계의 조각 수는 최대 worker_count + (쌍 경계와 노드 경계로 나뉜 구간 수 <= 2 * num_nodes) */
+    NumaMergeArg *args = (NumaMergeArg *)sort_malloc((worker_count + 2 * num_nodes) * sizeof(NumaMergeArg));
+    size_t *bounds = (size_t *)sort_malloc((num_nodes + 1) * sizeof(size_t));
+    if (SORT_UNLIKELY(args == NULL || bounds == NULL))
+    {
+        sort_free(args);
+        sort_free(bounds);
+        return -1;
+    }
+    sort_memcpy(bounds, node_bounds, (num_nodes + 1) * sizeof(size_t));
+
+    char *src = buf;
+    while (num_runs > 1)
+    {
+        int num_pairs = (num_runs + 1) / 2;
+        char *dest = (num_pairs == 1) ? arr : ((src == buf) ? tmp_arr : buf);
+        int num_pieces = 0;
+
+        for (int p = 0; p < num_pairs; p++)
+        {
+            /* 런 개수가 홀수이면 마지막 런은 짝 없이 (b 런 길이 0) 그대로 복사됨 */
+            size_t a_begin = bounds[2 * p];
+            size_t a_end = bounds[2 * p + 1];
+            size_t b_end = (2 * p + 1 < num_runs) ? bounds[2 * p + 2] : a_end;
+
+            /* 쌍의 출력 구간을 노드 경계로 자르고, 잘린 구간마다 크기에 비례하여 조각 수를 정함 */
+            for (int k = 0; k < num_nodes; k++)
+            {
+                size_t seg_begin = (node_bounds[k] > a_begin) ? node_bounds[k] : a_begin;
+                size_t seg_end = (node_bounds[k + 1] < b_end) ? node_bounds[k + 1] : b_end;
+                if (seg_begin >= seg_end)
+                {
+                    continue;
+                }
+                size_t seg_length = seg_end - seg_begin;
+                int pieces = (int)((double)worker_count * seg_length / num_of_elements);
+                if (pieces < 1)
+                {
+                    pieces = 1;
+                }
+                for (int q = 0; q < pieces; q++)
+                {
+                    NumaMergeArg *arg_ptr = &args[num_pieces];
+                    arg_ptr->dest = dest + a_begin * size_of_element;
+                    arg_ptr->a_run = src + a_begin * size_of_element;
+                    arg_ptr->num_a = a_end - a_begin;
+                    arg_ptr->b_run = src + a_end * size_of_element;
+                    arg_ptr->num_b = b_end - a_end;
+                    arg_ptr->out_begin = seg_begin - a_begin + seg_length * q / pieces;
+                    arg_ptr->out_end = seg_begin - a_begin + seg_length * (q + 1) / pieces;
+                    arg_ptr->size_of_element = size_of_element;
+                    arg_ptr->cmp_func_ptr = cmp_func_ptr;
+                    arg_ptr->node = &nodes[k];
+                    num_pieces++;
+                }
+            }
+        }
+        /* 조각 수가 노드 경계 때문에 작업 스레드 수를 넘을 수 있으므로 worker_count개씩 나눠 실행 */
+        for (int first = 0; first < num_pieces; first += worker_count)
+        {
+            int count = (num_pieces - first < worker_count) ? num_pieces - first : worker_count;
+            sort_run_workers(merge_piece, args + first, sizeof(NumaMergeArg), count);
+        }
+
+        for (int p = 0; p < num_pairs; p++)
+        {
+            bounds[p] = bounds[2 * p];
+        }
+        bounds[num_pairs] = num_of_elements;
+        num_runs = num_pairs;
+        src = dest;
+    }
+
+    sort_free(bounds);
+    sort_free(args);
+    return 0;
+}
+
+/**
+ * 두 런을 안정적으로 병합한 결과에서 out_pos 앞에 오는 a_run 원소의 개수를 이진 탐색으로 구함
+ * 같은 값은 a_run 원소가 먼저 오므로, a_run[i]가 b_run[j - 1]보다 작거나 같으면 i가 너무 작은 것
+ */
+static size_t co_rank(size_t out_pos, const char *a_run, size_t num_a, const char *b_run, size_t num_b, size_t size_of_element, CmpFunc cmp_func_ptr)
+{
+    size_t lo = (out_pos > num_b) ? out_pos - num_b : 0;
+    size_t hi = (out_pos < num_a) ? out_pos : num_a;
+    while (lo < hi)
+    {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = out_pos - i;
+        if (j > 0 && sort_compare(cmp_func_ptr, a_run + i * size_of_element, b_run + (j - 1) * size_of_element) <= 0)
+        {
+            lo = i + 1;
+        }
+        else
+        {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+/* 병합 조각 처리: 노드에 고정 후 담당 출력 구간에 해당하는 두 런의 부분을 병합 */
+static SORT_THREAD_PROC merge_piece(void *arg)
+{
+    NumaMergeArg *arg_ptr = (NumaMergeArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    CmpFunc cmp_func_ptr = arg_ptr->cmp_func_ptr;
+
+    NumaAffinity saved;
+    pin_to_node(arg_ptr->node, &saved);
+    size_t a_begin = co_rank(arg_ptr->out_begin, arg_ptr->a_run, arg_ptr->num_a, arg_ptr->b_run, arg_ptr->num_b, size_of_element, cmp_func_ptr);
+    size_t a_end = co_rank(arg_ptr->out_end, arg_ptr->a_run, arg_ptr->num_a, arg_ptr->b_run, arg_ptr->num_b, size_of_element, cmp_func_ptr);
+
+    const char *ptr_a = arg_ptr->a_run + a_begin * size_of_element;
+    const char *ptr_a_end = arg_ptr->a_run + a_end * size_of_element;
+    const char *ptr_b = arg_ptr->b_run + (arg_ptr->out_begin - a_begin) * size_of_element;
+    const char *ptr_b_end = arg_ptr->b_run + (arg_ptr->out_end - a_end) * size_of_element;
+    char *ptr_dest = arg_ptr->dest + arg_ptr->out_begin * size_of_element;
+
+    while (ptr_a < ptr_a_end && ptr_b < ptr_b_end)
+    {
+        if (sort_compare(cmp_func_ptr, ptr_b, ptr_a) < 0)
+        {
+            sort_memcpy(ptr_dest, ptr_b, size_of_element);
+            ptr_b += size_of_element;
+        }
+        else
+        {
+            sort_memcpy(ptr_dest, ptr_a, size_of_element);
+            ptr_a += size_of_element;
+        }
+        ptr_dest += size_of_element;
+    }
+    sort_memcpy(ptr_dest, ptr_a, ptr_a_end - ptr_a);
+    ptr_dest += ptr_a_end - ptr_a;
+    sort_memcpy(ptr_dest, ptr_b, ptr_b_end - ptr_b);
+    restore_affinity(&saved);
+    return 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file pair_sort.c
+ * @brief 키 배열과 분리된 값 배열(열)을 함께 정렬하는 구현부
+ *
+ * 키와 원래 위치만 담은 작은 레코드를 병합 정렬하므로 비교와 병합 단계의 메모리 이동이 키 크기로 제한되고,
+ * 값 열은 정렬이 끝난 뒤 원래 위치 목록을 따라 한 번만 옮김
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 멀티스레드 인자 전달용 구조체, [begin, end) 구간을 담당 */
+typedef struct ColumnArgStruct
+{
+    char *records;
+    size_t record_size;
+    size_t index_offset;
+    size_t *order;
+    char *column;
+    char *scratch;
+    size_t size_of_element;
+    size_t begin;
+    size_t end;
+} ColumnArg;
+
+static int column_worker_count(size_t num_of_elements);
+static void run_column_phase(SortThreadProc proc, ColumnArg *args, int num_workers, size_t num_of_elements, const ColumnArg *common);
+static SORT_THREAD_PROC unpack_chunk(void *arg);
+static SORT_THREAD_PROC gather_chunk(void *arg);
+static SORT_THREAD_PROC copy_back_chunk(void *arg);
+
+/* [공개 함수] 키 배열 기준으로 값 배열을 함께 정렬 */
+int sort_pairs(void *keys, void *values, size_t num_of_elements, size_t size_of_key, size_t size_of_value, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (values == NULL || size_of_value == 0)
+    {
+        return sort_columns(keys, num_of_elements, size_of_key, cmp_func_ptr, NULL, NULL, 0);
+    }
+    void *columns[1] = {values};
+    size_t column_sizes[1] = {size_of_value};
+    return sort_columns(keys, num_of_elements, size_of_key, cmp_func_ptr, columns, column_sizes, 1);
+}
+
+/* [공개 함수] 키 배열 기준으로 여러 값 열을 함께 정렬 */
+int sort_columns(void *keys, size_t num_of_elements, size_t size_of_key, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), void **columns, const size_t *column_sizes, size_t num_columns)
+{
+    if (SORT_UNLIKELY(keys == NULL || num_of_elements < 2 || size_of_key == 0))
+    {
+        return 0;
+    }
+    if (num_columns == 0)
+    {
+        return merge_sort_multi(keys, num_of_elements, size_of_key, cmp_func_ptr);
+    }
+
+    /* 레코드 = [키 | 원래 위치], 키가 레코드 맨 앞에 있으므로 사용자 비교 함수를 그대로 사용 */
+    size_t index_offset = (size_of_key + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t);
+    size_t record_size = index_offset + sizeof(size_t);
+    size_t max_column_size = 0;
+    for (size_t c = 0; c < num_columns; c++)
+    {
+        if (column_sizes[c] > max_column_size)
+        {
+            max_column_size = column_sizes[c];
+        }
+    }
+
+    int num_workers = column_worker_count(num_of_elements);
+    char *records = (char *)sort_malloc(num_of_elements * record_size);
+    size_t *order = (size_t *)sort_malloc(num_of_elements * sizeof(size_t));
+    char *scratch = (char *)sort_malloc(num_of_elements * (max_column_size > 0 ? max_column_size : 1));
+    ColumnArg *args = (ColumnArg *)sort_malloc(num_workers * sizeof(ColumnArg));
+    if (SORT_UNLIKELY(records == NULL || order == NULL || scratch == NULL || args == NULL))
+    {
+        sort_free(records);
+        sort_free(order);
+        sort_free(scratch);
+        sort_free(args);
+        return -1;
+    }
+
+    char *current = records;
+    char *key = (char *)keys;
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        sort_memcpy(current, key, size_of_key);
+        sort_memcpy(current + index_offset, &i, sizeof(size_t));
+        current += record_size;
+        key += size_of_key;
+    }
+
+    if (SORT_UNLIKELY(merge_sort_multi(records, num_of_elements, record_size, cmp_func_ptr) != 0))
+    {
+        sort_free(records);
+        sort_free(order);
+        sort_free(scratch);
+        sort_free(args);
+        return -1;
+    }
+
+    /* 정렬된 키를 되돌려 쓰고 원래 위치 목록을 꺼냄 */
+    ColumnArg common = {records, record_size, index_offset, order, (char *)keys, NULL, size_of_key, 0, 0};
+    run_column_phase(unpack_chunk, args, num_workers, num_of_elements, &common);
+
+    /* 각 열을 원래 위치 목록 순서로 임시 버퍼에 모은 뒤 한 번에 되돌려 씀 */
+    for (size_t c = 0; c < num_columns; c++)
+    {
+        if (columns[c] == NULL || column_sizes[c] == 0)
+        {
+            continue;
+        }
+        ColumnArg column_arg = {NULL, 0, 0, order, (char *)columns[c], scratch, column_sizes[c], 0, 0};
+        run_column_phase(gather_chunk, args, num_workers, num_of_elements, &column_arg);
+        run_column_phase(copy_back_chunk, args, num_workers, num_of_elements, &column_arg);
+    }
+
+    sort_free(records);
+    sort_free(order);
+    sort_free(scratch);
+    sort_free(args);
+    return 0;
+}
+
+/* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+static int column_worker_count(size_t num_of_elements)
+{
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_of_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(num_of_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    return (num_workers < 1) ? 1 : num_workers;
+}
+
+/* 전체 구간을 스레드 수만큼 나눠 proc을 실행 */
+static void run_column_phase(SortThreadProc proc, ColumnArg *args, int num_workers, size_t num_of_elements, const ColumnArg *common)
+{
+    size_t chunk = num_of_elements / num_workers;
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t] = *common;
+        args[t].begin = t * chunk;
+        args[t].end = (t == num_workers - 1) ? num_of_elements : (t + 1) * chunk;
+    }
+    sort_run_workers(proc, args, sizeof(ColumnArg), num_workers);
+}
+
+/* 레코드에서 키는 키 배열로, 원래 위치는 order로 복사 */
+static SORT_THREAD_PROC unpack_chunk(void *arg)
+{
+    ColumnArg *arg_ptr = (ColumnArg *)arg;
+    const char *current = arg_ptr->records + arg_ptr->begin * arg_ptr->record_size;
+    char *key = arg_ptr->column + arg_ptr->begin * arg_ptr->size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        sort_memcpy(key, current, arg_ptr->size_of_element);
+        sort_memcpy(&arg_ptr->order[i], current + arg_ptr->index_offset, sizeof(size_t));
+        current += arg_ptr->record_size;
+        key += arg_ptr->size_of_element;
+    }
+    return 0;
+}
+
+/* scratch[i] = column[order[i]] */
+static SORT_THREAD_PROC gather_chunk(void *arg)
+{
+    ColumnArg *arg_ptr = (ColumnArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    char *dest = arg_ptr->scratch + arg_ptr->begin * size_of_element;
+    for (size_t i = arg_ptr->begin; i < arg_ptr->end; i++)
+    {
+        sort_memcpy(dest, arg_ptr->column + arg_ptr->order[i] * size_of_element, size_of_element);
+        dest += size_of_element;
+    }
+    return 0;
+}
+
+/* 모인 열을 원래 배열로 되돌려 씀 */
+static SORT_THREAD_PROC copy_back_chunk(void *arg)
+{
+    ColumnArg *arg_ptr = (ColumnArg *)arg;
+    size_t offset = arg_ptr->begin * arg_ptr->size_of_element;
+    sort_memcpy(arg_ptr->column + offset, arg_ptr->scratch + offset, (arg_ptr->end - arg_ptr->begin) * arg_ptr->size_of_element);
+    return 0;
+}
@@ -0,0 +1,356 @@
+/**
+ * @file sample_sort.c
+ * @brief 멀티 스레드 샘플 정렬, 중복이 많은 입력용 정렬 구현부
+ *
+ * 표본에서 고른 분할자로 배열을 버킷으로 나눈 뒤, 각 버킷을 싱글 스레드 병합 정렬로 독립 정렬
+ * 분산(scatter)과 버킷 정렬이 모두 안정적이므로 전체 정렬도 안정 정렬임
+ * 중복이 많은 입력은 표본의 서로 다른 값 전체를 분할자로 삼아, 대부분의 원소가 정렬이 필요 없는 같은 값 버킷에 모이게 함
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 분할자 하나당 뽑을 표본 수 (클수록 버킷 크기가 고르게 나뉨) */
+#define SAMPLE_OVERSAMPLING 32
+/* 중복이 많은 입력 판별에 쓰는 표본 수와, 표본에서 서로 다른 값이 이보다 많으면 일반 정렬로 처리 */
+#define FEW_UNIQUE_SAMPLES 1024
+#define FEW_UNIQUE_MAX_KEYS 256
+/* 이 개수보다 작은 입력은 판별 없이 병합 정렬 */
+#define FEW_UNIQUE_MIN_ELEMENTS 4096
+
+/* 멀티스레드 인자 전달용 구조체 */
+typedef struct SampleArgStruct
+{
+    char *arr;
+    char *tmp_arr;
+    size_t size_of_element;
+    size_t begin;
+    size_t end;
+    const char *splitters;
+    size_t num_splitters;
+    size_t num_buckets;
+    CmpFunc cmp_func_ptr;
+    uint32_t *bucket_ids;         // 스레드 로컬 버퍼, 담당 구간 원소의 버킷 번호
+    size_t *bucket_counts;        // 스레드별 버킷 크기, 이후 쓰기 위치로 재사용
+    const size_t *bucket_bounds;  // 모든 스레드가 공유하는 버킷 경계 (num_buckets + 1개)
+    volatile size_t *next_bucket; // 버킷 정렬 단계에서 다음에 가져갈 버킷 번호
+} SampleArg;
+
+static int bucket_sort(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const char *splitters, size_t num_splitters, int num_workers);
+static size_t select_distinct_keys(char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, char **keys_out);
+static size_t select_splitters(char *arr, size_t num_of_elements, size_t size_of_element, int num_workers, CmpFunc cmp_func_ptr, char **splitters_out);
+static inline size_t classify(const char *element, const char *splitters, size_t num_splitters, size_t size_of_element, CmpFunc cmp_func_ptr);
+static SORT_THREAD_PROC classify_chunk(void *arg);
+static SORT_THREAD_PROC scatter_chunk(void *arg);
+static SORT_THREAD_PROC sort_buckets(void *arg);
+
+/* [공개 함수] 멀티 스레드 샘플 정렬 */
+int sample_sort_multi(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_of_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(num_of_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers <= 1)
+    {
+        return merge_sort(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+
+    char *splitters = NULL;
+    size_t num_splitters = select_splitters((char *)arr, num_of_elements, size_of_element, num_workers, cmp_func_ptr, &splitters);
+    if (SORT_UNLIKELY(splitters == NULL))
+    {
+        return -1;
+    }
+    int result = bucket_sort(arr, num_of_elements, size_of_element, cmp_func_ptr, splitters, num_splitters, num_workers);
+    sort_free(splitters);
+    return result;
+}
+
+/* [공개 함수] 중복이 많은 입력용 정렬 */
+int sort_few_unique(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return 0;
+    }
+    if (num_of_elements < FEW_UNIQUE_MIN_ELEMENTS)
+    {
+        return merge_sort(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+
+    char *keys = NULL;
+    size_t num_keys = select_distinct_keys((char *)arr, num_of_elements, size_of_element, cmp_func_ptr, &keys);
+    if (SORT_UNLIKELY(keys == NULL))
+    {
+        return -1;
+    }
+    if (num_keys > FEW_UNIQUE_MAX_KEYS)
+    {
+        /* 표본에서 서로 다른 값이 많으면 중복이 적은 입력으로 보고 병합 정렬 */
+        sort_free(keys);
+        return merge_sort_multi(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    }
+
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_of_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(num_of_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers < 1)
+    {
+        num_workers = 1;
+    }
+    int result = bucket_sort(arr, num_of_elements, size_of_element, cmp_func_ptr, keys, num_keys, num_workers);
+    sort_free(keys);
+    return result;
+}
+
+/**
+ * 정렬된 분할자로 배열을 버킷에 분산한 뒤 버킷별로 정렬
+ * 분할자 i마다 (분할자 i-1, 분할자 i) 구간 버킷과 분할자 i와 같은 원소만 담는 버킷을 둠
+ */
+static int bucket_sort(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const char *splitters, size_t num_splitters, int num_workers)
+{
+    size_t num_buckets = 2 * num_splitters + 1;
+    void *tmp_arr = sort_malloc(num_of_elements * size_of_element);
+    uint32_t *bucket_ids = (uint32_t *)sort_malloc(num_of_elements * sizeof(uint32_t));
+    size_t *bucket_counts = (size_t *)sort_calloc((size_t)num_workers * num_buckets, sizeof(size_t));
+    size_t *bucket_bounds = (size_t *)sort_malloc((num_buckets + 1) * sizeof(size_t));
+    SampleArg *args = (SampleArg *)sort_malloc(num_workers * sizeof(SampleArg));
+    if (SORT_UNLIKELY(tmp_arr == NULL || bucket_ids == NULL || bucket_counts == NULL || bucket_bounds == NULL || args == NULL))
+    {
+        sort_free(tmp_arr);
+        sort_free(bucket_ids);
+        sort_free(bucket_counts);
+        sort_free(bucket_bounds);
+        sort_free(args);
+        return -1;
+    }
+
+    volatile size_t next_bucket = 0;
+    size_t chunk = num_of_elements / num_workers;
+    for (int t = 0; t < num_workers; t++)
+    {
+        SampleArg *arg_ptr = &args[t];
+        arg_ptr->arr = (char *)arr;
+        arg_ptr->tmp_arr = (char *)tmp_arr;
+        arg_ptr->size_of_element = size_of_element;
+        arg_ptr->begin = t * chunk;
+        arg_ptr->end = (t == num_workers - 1) ? num_of_elements : (t + 1) * chunk;
+        arg_ptr->splitters = splitters;
+        arg_ptr->num_splitters = num_splitters;
+        arg_ptr->num_buckets = num_buckets;
+        arg_ptr->cmp_func_ptr = cmp_func_ptr;
+        arg_ptr->bucket_ids = bucket_ids + arg_ptr->begin;
+        arg_ptr->bucket_counts = bucket_counts + t * num_buckets;
+        arg_ptr->bucket_bounds = bucket_bounds;
+        arg_ptr->next_bucket = &next_bucket;
+    }
+
+    /* 1단계: 각 스레드가 담당 구간 원소의 버킷을 정하고 개수를 셈 */
+    sort_run_workers(classify_chunk, args, sizeof(SampleArg), num_workers);
+
+    /* 버킷 경계와 스레드별 쓰기 위치 계산 (버킷 순서 -> 스레드 순서로 누적하여 안정성 유지) */
+    size_t pos = 0;
+    for (size_t b = 0; b < num_buckets; b++)
+    {
+        bucket_bounds[b] = pos;
+        for (int t = 0; t < num_workers; t++)
+        {
+            size_t count = args[t].bucket_counts[b];
+            args[t].bucket_counts[b] = pos;
+            pos += count;
+        }
+    }
+    bucket_bounds[num_buckets] = pos;
+
+    /* 2단계: 버킷 순서대로 tmp_arr에 분산 */
+    sort_run_workers(scatter_chunk, args, sizeof(SampleArg), num_workers);
+
+    /* 3단계: 버킷 단위로 가져가며 정렬 후 원본 배열로 복사 */
+    sort_run_workers(sort_buckets, args, sizeof(SampleArg), num_workers);
+
+    sort_free(args);
+    sort_free(bucket_bounds);
+    sort_free(bucket_counts);
+    sort_free(bucket_ids);
+    sort_free(tmp_arr);
+    return 0;
+}
+
+/**
+ * 배열에서 표본을 뽑아 정렬한 뒤 서로 다른 값만 남겨 *keys_out에 기록하고 그 개수를 반환
+ * 표본에 없던 드문 값은 분할자 사이 버킷으로 분산되어 정렬되므로 결과는 항상 올바름 (할당 실패 시 *keys_out은 NULL)
+ */
+static size_t select_distinct_keys(char *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, char **keys_out)
+{
+    size_t num_samples = (num_of_elements < FEW_UNIQUE_SAMPLES) ? num_of_elements : FEW_UNIQUE_SAMPLES;
+    char *samples = (char *)sort_malloc(2 * num_samples * size_of_element);
+    if (SORT_UNLIKELY(samples == NULL))
+    {
+        *keys_out = NULL;
+        return 0;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    size_t stride = num_of_elements / num_samples;
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t index = i * stride + (size_t)(state % stride);
+        sort_memcpy(samples + i * size_of_element, arr + index * size_of_element, size_of_element);
+    }
+    internal_merge_sort(samples, samples + num_samples * size_of_element, size_of_element, 0, num_samples - 1, cmp_func_ptr);
+
+    /* 정렬된 표본을 제자리에서 압축 */
+    size_t num_keys = 1;
+    for (size_t i = 1; i < num_samples; i++)
+    {
+        char *candidate = samples + i * size_of_element;
+        if (sort_compare(cmp_func_ptr, samples + (num_keys - 1) * size_of_element, candidate) != 0)
+        {
+            if (num_keys != i)
+            {
+                sort_memcpy(samples + num_keys * size_of_element, candidate, size_of_element);
+            }
+            num_keys++;
+        }
+    }
+    *keys_out = samples;
+    return num_keys;
+}
+
+/**
+ * 배열 전체에 고르게 퍼진 표본을 뽑아 정렬한 뒤 num_workers - 1개의 분할자를 고름
+ * 중복된 분할자는 하나로 합치며, 분할자 개수를 반환 (할당 실패 시 *splitters_out은 NULL)
+ */
+static size_t select_splitters(char *arr, size_t num_of_elements, size_t size_of_element, int num_workers, CmpFunc cmp_func_ptr, char **splitters_out)
+{
+    size_t num_samples = (size_t)num_workers * SAMPLE_OVERSAMPLING;
+    if (num_samples > num_of_elements)
+    {
+        num_samples = num_of_elements;
+    }
+    char *samples = (char *)sort_malloc(2 * num_samples * size_of_element);
+    char *splitters = (char *)sort_malloc((size_t)(num_workers - 1) * size_of_element);
+    if (SORT_UNLIKELY(samples == NULL || splitters == NULL))
+    {
+        sort_free(samples);
+        sort_free(splitters);
+        *splitters_out = NULL;
+        return 0;
+    }
+
+    /* 구간마다 하나씩, 구간 안의 위치는 고정 시드 xorshift로 정해 입력 패턴의 영향을 줄임 */
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    size_t stride = num_of_elements / num_samples;
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t index = i * stride + (size_t)(state % stride);
+        sort_memcpy(samples + i * size_of_element, arr + index * size_of_element, size_of_element);
+    }
+    internal_merge_sort(samples, samples + num_samples * size_of_element, size_of_element, 0, num_samples - 1, cmp_func_ptr);
+
+    size_t num_splitters = 0;
+    for (int i = 1; i < num_workers; i++)
+    {
+        char *candidate = samples + ((size_t)i * num_samples / num_workers) * size_of_element;
+        if (num_splitters > 0 && sort_compare(cmp_func_ptr, splitters + (num_splitters - 1) * size_of_element, candidate) == 0)
+        {
+            continue;
+        }
+        sort_memcpy(splitters + num_splitters * size_of_element, candidate, size_of_element);
+        num_splitters++;
+    }
+    sort_free(samples);
+    *splitters_out = splitters;
+    return num_splitters;
+}
+
+/* 원소의 버킷 번호: 자신보다 크거나 같은 첫 분할자 j를 찾아, 같으면 2j + 1, 아니면 2j */
+static inline size_t classify(const char *element, const char *splitters, size_t num_splitters, size_t size_of_element, CmpFunc cmp_func_ptr)
+{
+    size_t lo = 0;
+    size_t hi = num_splitters;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (sort_compare(cmp_func_ptr, splitters + mid * size_of_element, element) < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo < num_splitters && sort_compare(cmp_func_ptr, element, splitters + lo * size_of_element) == 0)
+    {
+        return 2 * lo + 1;
+    }
+    return 2 * lo;
+}
+
+static SORT_THREAD_PROC classify_chunk(void *arg)
+{
+    SampleArg *arg_ptr = (SampleArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    const char *current = arg_ptr->arr + arg_ptr->begin * size_of_element;
+    for (size_t i = 0; i < arg_ptr->end - arg_ptr->begin; i++)
+    {
+        size_t bucket = classify(current, arg_ptr->splitters, arg_ptr->num_splitters, size_of_element, arg_ptr->cmp_func_ptr);
+        arg_ptr->bucket_ids[i] = (uint32_t)bucket;
+        arg_ptr->bucket_counts[bucket]++;
+        current += size_of_element;
+    }
+    return 0;
+}
+
+static SORT_THREAD_PROC scatter_chunk(void *arg)
+{
+    SampleArg *arg_ptr = (SampleArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    const char *current = arg_ptr->arr + arg_ptr->begin * size_of_element;
+    for (size_t i = 0; i < arg_ptr->end - arg_ptr->begin; i++)
+    {
+        size_t *write_pos = &arg_ptr->bucket_counts[arg_ptr->bucket_ids[i]];
+        sort_memcpy(arg_ptr->tmp_arr + (*write_pos) * size_of_element, current, size_of_element);
+        (*write_pos)++;
+        current += size_of_element;
+    }
+    return 0;
+}
+
+/* 남은 버킷을 하나씩 가져가 정렬, 원본 배열의 같은 구간을 임시 공간으로 쓴 뒤 결과를 덮어씀 */
+static SORT_THREAD_PROC sort_buckets(void *arg)
+{
+    SampleArg *arg_ptr = (SampleArg *)arg;
+    size_t size_of_element = arg_ptr->size_of_element;
+    size_t bucket;
+    while ((bucket = sort_atomic_fetch_add(arg_ptr->next_bucket, 1)) < arg_ptr->num_buckets)
+    {
+        size_t left = arg_ptr->bucket_bounds[bucket];
+        size_t right_end = arg_ptr->bucket_bounds[bucket + 1];
+        if (left == right_end)
+        {
+            continue;
+        }
+        /* 홀수 번호 버킷은 모두 분할자와 같은 원소이므로 정렬이 필요 없음 */
+        if ((bucket & 1) == 0)
+        {
+            internal_merge_sort(arg_ptr->tmp_arr, arg_ptr->arr, size_of_element, left, right_end - 1, arg_ptr->cmp_func_ptr);
+        }
+        sort_memcpy(arg_ptr->arr + left * size_of_element, arg_ptr->tmp_arr + left * size_of_element, (right_end - left) * size_of_element);
+    }
+    return 0;
+}
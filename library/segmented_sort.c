@@ -0,0 +1,189 @@
+/**
+ * @file segmented_sort.c
+ * @brief 구간별 정렬 구현부 (하나의 버퍼를 offsets 경계로 나눈 각 구간을 독립적으로 정렬)
+ */
+
+#include <stdlib.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 길이 이하의 구간은 이진 삽입 정렬, 초과하면 병합 정렬 */
+#define SEGMENT_INSERTION_LIMIT 64
+
+/* 멀티스레드 인자 전달용 구조체, 구간 [first, last) 를 담당 */
+typedef struct SegmentArgStruct
+{
+    char *arr;
+    const size_t *offsets;
+    size_t first;
+    size_t last;
+    size_t huge_limit;
+    size_t size_of_element;
+    CmpFunc cmp_func_ptr;
+    int result;
+} SegmentArg;
+
+static inline size_t segment_cost(size_t length);
+static SORT_THREAD_PROC segment_worker(void *arg);
+
+/* [공개 함수] 구간별 정렬 */
+int segmented_sort(void *arr, const size_t *offsets, size_t num_segments, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || offsets == NULL || num_segments == 0 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    size_t total_elements = offsets[num_segments] - offsets[0];
+
+    /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+    int cpu_count = sort_worker_count();
+    int num_workers = (total_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(total_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers < 1)
+    {
+        num_workers = 1;
+    }
+    /* 스레드 하나의 몫보다 긴 구간은 분배에서 빼고 나중에 모든 스레드로 정렬 */
+    size_t huge_limit = (num_workers > 1) ? total_elements / num_workers : (size_t)-1;
+    size_t total_cost = 0;
+    for (size_t i = 0; i < num_segments; i++)
+    {
+        size_t length = offsets[i + 1] - offsets[i];
+        if (length <= huge_limit)
+        {
+            total_cost += segment_cost(length);
+        }
+    }
+
+    SegmentArg *args = (SegmentArg *)sort_malloc(num_workers * sizeof(SegmentArg));
+    if (SORT_UNLIKELY(args == NULL))
+    {
+        return -1;
+    }
+
+    /* 연속된 구간들을 예상 비용이 고르게 나뉘도록 잘라 스레드에 배정 (메모리 지역성 유지)
+     * 긴 구간은 segment_worker가 건너뛰므로 비용에 넣지 않음 (넣으면 그 구간을 맡은 스레드만 일이 적어짐) */
+    size_t first = 0;
+    size_t cost_so_far = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        size_t target = total_cost / num_workers * (t + 1);
+        size_t last = first;
+        if (t == num_workers - 1)
+        {
+            last = num_segments;
+        }
+        else
+        {
+            while (last < num_segments && cost_so_far < target)
+            {
+                size_t length = offsets[last + 1] - offsets[last];
+                if (length <= huge_limit)
+                {
+                    cost_so_far += segment_cost(length);
+                }
+                last++;
+            }
+        }
+        SegmentArg segment_arg = {(char *)arr, offsets, first, last, huge_limit, size_of_element, cmp_func_ptr, 0};
+        args[t] = segment_arg;
+        first = last;
+    }
+
+    sort_run_workers(segment_worker, args, sizeof(SegmentArg), num_workers);
+
+    int result = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        if (args[t].result != 0)
+        {
+            result = args[t].result;
+        }
+    }
+    sort_free(args);
+
+    if (num_workers > 1)
+    {
+        size_t max_huge = 0;
+        for (size_t i = 0; i < num_segments; i++)
+        {
+            size_t length = offsets[i + 1] - offsets[i];
+            if (length > huge_limit && length > max_huge)
+            {
+                max_huge = length;
+            }
+        }
+        if (max_huge > 0)
+        {
+            void *tmp_arr = sort_malloc(max_huge * size_of_element);
+            if (SORT_UNLIKELY(tmp_arr == NULL))
+            {
+                return -1;
+            }
+            for (size_t i = 0; i < num_segments; i++)
+            {
+                size_t length = offsets[i + 1] - offsets[i];
+                if (length > huge_limit)
+                {
+                    internal_merge_sort_multi((char *)arr + offsets[i] * size_of_element, tmp_arr, size_of_element, 0, length - 1, cmp_func_ptr, num_workers);
+                }
+            }
+            sort_free(tmp_arr);
+        }
+    }
+    return result;
+}
+
+/* 스레드 분배용 예상 비용 n * ceil(log2(n + 1)) */
+static inline size_t segment_cost(size_t length)
+{
+    size_t levels = 1;
+    while (((size_t)1 << levels) <= length && levels < sizeof(size_t) * 8 - 1)
+    {
+        levels++;
+    }
+    return length * levels;
+}
+
+/* 담당 구간들을 차례로 정렬, 병합 정렬용 임시 버퍼는 가장 긴 구간 기준으로 한 번만 할당 */
+static SORT_THREAD_PROC segment_worker(void *arg)
+{
+    SegmentArg *arg_ptr = (SegmentArg *)arg;
+    const size_t *offsets = arg_ptr->offsets;
+    size_t size_of_element = arg_ptr->size_of_element;
+
+    size_t max_length = 0;
+    for (size_t i = arg_ptr->first; i < arg_ptr->last; i++)
+    {
+        size_t length = offsets[i + 1] - offsets[i];
+        if (length > SEGMENT_INSERTION_LIMIT && length <= arg_ptr->huge_limit && length > max_length)
+        {
+            max_length = length;
+        }
+    }
+    void *tmp_arr = NULL;
+    if (max_length > 0)
+    {
+        tmp_arr = sort_malloc(max_length * size_of_element);
+        if (SORT_UNLIKELY(tmp_arr == NULL))
+        {
+            arg_ptr->result = -1;
+        }
+    }
+
+    for (size_t i = arg_ptr->first; i < arg_ptr->last; i++)
+    {
+        size_t length = offsets[i + 1] - offsets[i];
+        char *segment = arg_ptr->arr + offsets[i] * size_of_element;
+        if (length <= SEGMENT_INSERTION_LIMIT)
+        {
+            insertion_sort_binary(segment, length, size_of_element, arg_ptr->cmp_func_ptr);
+        }
+        else if (length <= arg_ptr->huge_limit && tmp_arr != NULL)
+        {
+            internal_merge_sort(segment, tmp_arr, size_of_element, 0, length - 1, arg_ptr->cmp_func_ptr);
+        }
+    }
+    sort_free(tmp_arr);
+    return 0;
+}
@@ -5,6 +5,7 @@
 
 #include <stddef.h>
 #include "../library/sorting.h"
+#include "../library/sort_internal.h"
 
 void selection_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
 {
@@ -20,7 +21,7 @@ void selection_sort(void *arr, size_t num_of_elements, size_t size_of_element, i
         void *scan = (char *)current + size_of_element;
         for (size_t j = i + 1; j < num_of_elements; j++)
         {
-            if (cmp_func_ptr(select, scan) > 0)
+            if (sort_compare(cmp_func_ptr, select, scan) > 0)
             {
                 select = scan;
             }
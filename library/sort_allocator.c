@@ -0,0 +1,21 @@
+/**
+ * @file sort_allocator.c
+ * @brief 작업 공간 할당 함수 교체 구현부
+ */
+
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+SortAllocator sort_allocator;
+
+/* [공개 함수] 작업 공간 할당 함수 교체 */
+void sort_set_allocator(const SortAllocator *allocator)
+{
+    if (allocator == NULL || allocator->malloc_func_ptr == NULL || allocator->realloc_func_ptr == NULL || allocator->free_func_ptr == NULL)
+    {
+        memset(&sort_allocator, 0, sizeof(sort_allocator));
+        return;
+    }
+    sort_allocator = *allocator;
+}
@@ -0,0 +1,286 @@
+/**
+ * @file sort_async.c
+ * @brief 비동기 정렬 구현부 (라이브러리 작업 스레드 풀, 작은 정렬 묶음 처리)
+ *
+ * 처음 sort_async를 호출할 때 작업 스레드 풀을 만들고, 요청은 큐에 넣어 작업 스레드가 순서대로 처리
+ * 작은 정렬 요청이 연속으로 쌓여 있으면 한 작업 스레드가 여러 개를 묶어서 임시 버퍼 하나로 처리
+ * 큰 요청은 멀티 스레드로 정렬하되, 동시에 실행 중인 큰 요청끼리 sort_worker_count()개의 스레드를 나눠 써서 과도한 스레드 생성을 막음
+ * 풀의 스레드는 분리(detach)된 상태로 프로세스가 끝날 때까지 대기하며 회수하지 않음
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수보다 작은 요청은 작은 정렬로 보고 묶어서 처리 */
+#define ASYNC_SMALL_LIMIT SORT_PARALLEL_THRESHOLD
+/* 한 번에 묶을 작은 정렬 요청의 최대 개수 */
+#define ASYNC_BATCH_MAX 32
+
+struct SortHandleStruct
+{
+    void *arr;
+    size_t num_of_elements;
+    size_t size_of_element;
+    CmpFunc cmp_func_ptr;
+    SortOptions options;
+    int has_options;
+
+    SortMutex mutex;
+    SortCond cond;
+    int is_done;
+    int result;
+    int ref_count;      // 사용자와 작업 스레드가 하나씩 가짐, 0이 되면 해제
+    void (*complete_func_ptr)(int result, void *user_data);
+    void *complete_user_data;
+
+    struct SortHandleStruct *next; // 작업 큐 연결
+};
+
+/* 전역 작업 큐와 스레드 풀 상태 */
+static SortMutex queue_mutex = SORT_MUTEX_INIT;
+static SortCond queue_cond = SORT_COND_INIT;
+static SortHandle *queue_head = NULL;
+static SortHandle *queue_tail = NULL;
+static int num_pool_workers = -1; // -1이면 아직 풀을 만들지 않음
+static int num_large_jobs = 0;    // 실행 중인 큰 요청 수 (queue_mutex로 보호)
+
+static int ensure_pool(void);
+static SORT_THREAD_PROC pool_worker(void *arg);
+static size_t pop_batch(SortHandle **batch);
+static void run_batch(SortHandle **batch, size_t batch_count);
+static void complete_handle(SortHandle *handle, int result);
+static void release_handle(SortHandle *handle);
+
+/* [공개 함수] 비동기 정렬 요청 */
+SortHandle *sort_async(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options)
+{
+    SortHandle *handle = (SortHandle *)sort_calloc(1, sizeof(SortHandle));
+    if (SORT_UNLIKELY(handle == NULL))
+    {
+        return NULL;
+    }
+    handle->arr = arr;
+    handle->num_of_elements = num_of_elements;
+    handle->size_of_element = size_of_element;
+    handle->cmp_func_ptr = cmp_func_ptr;
+    if (options != NULL)
+    {
+        handle->options = *options; // 호출자의 구조체가 먼저 사라져도 되도록 복사
+        handle->has_options = 1;
+    }
+    sort_mutex_init(&handle->mutex);
+    sort_cond_init(&handle->cond);
+    handle->ref_count = 2;
+
+    if (SORT_UNLIKELY(ensure_pool() == 0))
+    {
+        /* 작업 스레드를 하나도 만들지 못하면 현재 스레드에서 바로 처리 */
+        run_batch(&handle, 1);
+        return handle;
+    }
+
+    sort_mutex_lock(&queue_mutex);
+    if (queue_tail == NULL)
+    {
+        queue_head = handle;
+    }
+    else
+    {
+        queue_tail->next = handle;
+    }
+    queue_tail = handle;
+    sort_cond_signal(&queue_cond);
+    sort_mutex_unlock(&queue_mutex);
+    return handle;
+}
+
+/* [공개 함수] 정렬이 끝날 때까지 대기 */
+int sort_wait(SortHandle *handle)
+{
+    sort_mutex_lock(&handle->mutex);
+    while (!handle->is_done)
+    {
+        sort_cond_wait(&handle->cond, &handle->mutex);
+    }
+    int result = handle->result;
+    sort_mutex_unlock(&handle->mutex);
+    return result;
+}
+
+/* [공개 함수] 대기 없이 완료 여부 확인 */
+int sort_try_wait(SortHandle *handle, int *result)
+{
+    sort_mutex_lock(&handle->mutex);
+    int is_done = handle->is_done;
+    if (is_done && result != NULL)
+    {
+        *result = handle->result;
+    }
+    sort_mutex_unlock(&handle->mutex);
+    return is_done;
+}
+
+/* [공개 함수] 완료 콜백 등록 */
+void sort_on_complete(SortHandle *handle, void (*complete_func_ptr)(int result, void *user_data), void *user_data)
+{
+    sort_mutex_lock(&handle->mutex);
+    if (!handle->is_done)
+    {
+        handle->complete_func_ptr = complete_func_ptr;
+        handle->complete_user_data = user_data;
+        sort_mutex_unlock(&handle->mutex);
+        return;
+    }
+    int result = handle->result;
+    sort_mutex_unlock(&handle->mutex);
+    /* 이미 끝났으면 호출한 스레드에서 바로 실행 */
+    complete_func_ptr(result, user_data);
+}
+
+/* [공개 함수] 핸들 반환 */
+void sort_handle_release(SortHandle *handle)
+{
+    if (handle != NULL)
+    {
+        release_handle(handle);
+    }
+}
+
+/* 처음 호출될 때 작업 스레드 풀을 만들고 작업 스레드 수를 반환 */
+static int ensure_pool(void)
+{
+    sort_mutex_lock(&queue_mutex);
+    if (num_pool_workers < 0)
+    {
+        num_pool_workers = 0;
+        int worker_count = sort_worker_count();
+        for (int t = 0; t < worker_count; t++)
+        {
+            SortThread thread;
+            if (sort_thread_create(&thread, pool_worker, NULL) == 0)
+            {
+                sort_thread_detach(thread);
+                num_pool_workers++;
+            }
+        }
+    }
+    int count = num_pool_workers;
+    sort_mutex_unlock(&queue_mutex);
+    return count;
+}
+
+/* 작업 스레드: 큐에서 요청(또는 작은 요청 묶음)을 꺼내 처리하는 것을 반복 */
+static SORT_THREAD_PROC pool_worker(void *arg)
+{
+    (void)arg;
+    SortHandle *batch[ASYNC_BATCH_MAX];
+    for (;;)
+    {
+        size_t batch_count = pop_batch(batch);
+        run_batch(batch, batch_count);
+    }
+    return 0;
+}
+
+/* 큐가 빌 때는 대기, 맨 앞 요청이 작으면 뒤따르는 작은 요청들도 함께 꺼냄 */
+static size_t pop_batch(SortHandle **batch)
+{
+    sort_mutex_lock(&queue_mutex);
+    while (queue_head == NULL)
+    {
+        sort_cond_wait(&queue_cond, &queue_mutex);
+    }
+    size_t batch_count = 0;
+    do
+    {
+        batch[batch_count++] = queue_head;
+        queue_head = queue_head->next;
+    } while (queue_head != NULL && batch_count < ASYNC_BATCH_MAX && batch[0]->num_of_elements < ASYNC_SMALL_LIMIT && queue_head->num_of_elements < ASYNC_SMALL_LIMIT);
+    if (queue_head == NULL)
+    {
+        queue_tail = NULL;
+    }
+    sort_mutex_unlock(&queue_mutex);
+    return batch_count;
+}
+
+/* 요청 묶음 처리, 옵션이 없는 작은 정렬은 임시 버퍼 하나를 함께 사용 */
+static void run_batch(SortHandle **batch, size_t batch_count)
+{
+    if (batch_count == 1 && batch[0]->num_of_elements >= ASYNC_SMALL_LIMIT)
+    {
+        SortHandle *handle = batch[0];
+        const SortOptions *options = handle->has_options ? &handle->options : NULL;
+        /* 시작 시점에 실행 중인 큰 요청 수로 스레드 수를 나눔 (이 작업 스레드도 정렬에 참여) */
+        sort_mutex_lock(&queue_mutex);
+        int num_threads = sort_worker_count() / ++num_large_jobs;
+        sort_mutex_unlock(&queue_mutex);
+        int result = internal_merge_sort_ex(handle->arr, handle->num_of_elements, handle->size_of_element, handle->cmp_func_ptr, options, (num_threads > 0) ? num_threads : 1);
+        sort_mutex_lock(&queue_mutex);
+        num_large_jobs--;
+        sort_mutex_unlock(&queue_mutex);
+        complete_handle(handle, result);
+        return;
+    }
+
+    size_t max_bytes = 0;
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        size_t bytes = batch[i]->num_of_elements * batch[i]->size_of_element;
+        if (bytes > max_bytes)
+        {
+            max_bytes = bytes;
+        }
+    }
+    void *tmp_arr = (max_bytes > 0) ? sort_malloc(max_bytes) : NULL;
+
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        SortHandle *handle = batch[i];
+        int result = SORT_OK;
+        if (handle->has_options || tmp_arr == NULL)
+        {
+            result = merge_sort_ex(handle->arr, handle->num_of_elements, handle->size_of_element, handle->cmp_func_ptr, handle->has_options ? &handle->options : NULL);
+        }
+        else if (handle->arr != NULL && handle->num_of_elements > 1 && handle->size_of_element > 0)
+        {
+            internal_merge_sort(handle->arr, tmp_arr, handle->size_of_element, 0, handle->num_of_elements - 1, handle->cmp_func_ptr);
+        }
+        complete_handle(handle, result);
+    }
+    sort_free(tmp_arr);
+}
+
+/* 결과를 기록하고 대기 중인 스레드를 깨운 뒤, 등록된 콜백을 잠금 밖에서 호출 */
+static void complete_handle(SortHandle *handle, int result)
+{
+    sort_mutex_lock(&handle->mutex);
+    handle->result = result;
+    handle->is_done = 1;
+    void (*complete_func_ptr)(int result, void *user_data) = handle->complete_func_ptr;
+    void *user_data = handle->complete_user_data;
+    sort_cond_broadcast(&handle->cond);
+    sort_mutex_unlock(&handle->mutex);
+
+    if (complete_func_ptr != NULL)
+    {
+        complete_func_ptr(result, user_data);
+    }
+    release_handle(handle);
+}
+
+/* 참조 수를 줄이고 사용자와 작업 스레드 모두 반환하면 해제 */
+static void release_handle(SortHandle *handle)
+{
+    sort_mutex_lock(&handle->mutex);
+    int ref_count = --handle->ref_count;
+    sort_mutex_unlock(&handle->mutex);
+    if (ref_count == 0)
+    {
+        sort_cond_destroy(&handle->cond);
+        sort_mutex_destroy(&handle->mutex);
+        sort_free(handle);
+    }
+}
@@ -0,0 +1,425 @@
+/**
+ * @file sort_internal.h
+ *
+ * @brief 라이브러리 내부 구현부끼리 공유하는 헬퍼 (공개 API 아님)
+ *
+ * 스레드 생성/대기와 코어 수 계산을 플랫폼별로 감싸서,
+ * 여러 구현 파일이 merge_sort_multi와 같은 스레드 분배 규칙을 사용하도록 함
+ *
+ * */
+
+#ifndef SORT_INTERNAL_H
+#define SORT_INTERNAL_H
+
+#include "sorting.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <process.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+    #include <time.h>
+#endif
+
+/* --- tuning.c --- */
+
+/* 현재 적용 중인 튜닝 값, 처음 호출될 때 설정 파일(있으면)을 읽음 */
+const SortTuning *sort_tuning_current(void);
+
+/* 병렬 처리를 수행할 최소 데이터 개수 (스레드 과생성 방지) */
+#define SORT_PARALLEL_THRESHOLD (sort_tuning_current()->parallel_threshold)
+/* 병합 정렬에서 이 개수 이하의 구간은 이진 삽입 정렬로 처리 */
+#define SORT_INSERTION_CUTOFF (sort_tuning_current()->insertion_cutoff)
+/* 자동 정렬이 정렬된 정도와 중복 비율을 조사할 표본 수 (보정 실행에서도 같은 값을 사용) */
+#define SORT_AUTO_PROBE_SAMPLES 256
+
+typedef int (*CmpFunc)(const void *a_ptr, const void *b_ptr);
+
+/* 여러 스레드가 공유하는 카운터를 value만큼 증가시키고 이전 값을 반환 */
+static inline size_t sort_atomic_fetch_add(volatile size_t *ptr, size_t value)
+{
+#if defined(_WIN64)
+    return (size_t)InterlockedExchangeAdd64((volatile LONG64 *)ptr, (LONG64)value);
+#elif defined(_WIN32)
+    return (size_t)InterlockedExchangeAdd((volatile LONG *)ptr, (LONG)value);
+#else
+    return __atomic_fetch_add(ptr, value, __ATOMIC_RELAXED);
+#endif
+}
+
+/* *ptr이 expected이면 desired로 바꾸고 1을, 다른 스레드가 먼저 바꿨으면 0을 반환 */
+static inline int sort_atomic_compare_exchange(volatile size_t *ptr, size_t expected, size_t desired)
+{
+#if defined(_WIN64)
+    return (size_t)InterlockedCompareExchange64((volatile LONG64 *)ptr, (LONG64)desired, (LONG64)expected) == expected;
+#elif defined(_WIN32)
+    return (size_t)InterlockedCompareExchange((volatile LONG *)ptr, (LONG)desired, (LONG)expected) == expected;
+#else
+    return __atomic_compare_exchange_n(ptr, &expected, desired, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#endif
+}
+
+/* sort_atomic_store_release로 기록한 값을 읽고, 그 전에 기록된 내용도 모두 보이게 함 (Interlocked 함수는 완전한 메모리 장벽) */
+static inline size_t sort_atomic_load_acquire(volatile size_t *ptr)
+{
+#if defined(_WIN32)
+    return sort_atomic_fetch_add(ptr, 0);
+#else
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/* 이전에 기록한 내용을 모두 공개한 뒤 value를 기록 (한 번만 하는 초기화의 완료 표시 등) */
+static inline void sort_atomic_store_release(volatile size_t *ptr, size_t value)
+{
+#if defined(_WIN64)
+    InterlockedExchange64((volatile LONG64 *)ptr, (LONG64)value);
+#elif defined(_WIN32)
+    InterlockedExchange((volatile LONG *)ptr, (LONG)value);
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/* --- sort_allocator.c --- */
+
+/* sort_set_allocator로 교체한 할당 함수, malloc_func_ptr이 NULL이면 표준 함수 사용 */
+extern SortAllocator sort_allocator;
+
+/* --- sort_stats.c --- */
+
+#if defined(SORT_STATS)
+    extern SortStats sort_stats_counters;
+    #define SORT_STATS_ADD(field, value) ((void)sort_atomic_fetch_add(&sort_stats_counters.field, (size_t)(value)))
+#else
+    #define SORT_STATS_ADD(field, value) ((void)0)
+#endif
+
+/* --- sort_trace.c --- */
+
+/* 추적 빌드(SORT_TRACE)에서 SORT_TRACE_START부터 SORT_TRACE_STOP까지를 현재 스레드의 구간 name으로 기록 (count는 다룬 원소 수) */
+#if defined(SORT_TRACE)
+    void sort_trace_record(const char *name, double start, size_t count);
+    #define SORT_TRACE_START(var) double var = sort_now_seconds()
+    #define SORT_TRACE_STOP(var, name, count) sort_trace_record((name), (var), (size_t)(count))
+#else
+    #define SORT_TRACE_START(var) ((void)0)
+    #define SORT_TRACE_STOP(var, name, count) ((void)0)
+#endif
+
+/* 비교 함수 호출 (계측 빌드에서는 횟수를 셈) */
+static inline int sort_compare(CmpFunc cmp_func_ptr, const void *a_ptr, const void *b_ptr)
+{
+    SORT_STATS_ADD(comparisons, 1);
+    return cmp_func_ptr(a_ptr, b_ptr);
+}
+
+/* 원소 복사와 메모리 할당, 라이브러리 내부에서는 표준 함수 대신 사용 (계측 빌드에서는 횟수와 바이트 수를 셈) */
+static inline void *sort_memcpy(void *SORT_RESTRICT dest, const void *SORT_RESTRICT src, size_t bytes)
+{
+    SORT_STATS_ADD(bytes_copied, bytes);
+    return memcpy(dest, src, bytes);
+}
+
+static inline void *sort_memmove(void *dest, const void *src, size_t bytes)
+{
+    SORT_STATS_ADD(bytes_copied, bytes);
+    return memmove(dest, src, bytes);
+}
+
+static inline void *sort_malloc(size_t bytes)
+{
+    SORT_STATS_ADD(allocations, 1);
+    SORT_STATS_ADD(bytes_allocated, bytes);
+    if (SORT_UNLIKELY(sort_allocator.malloc_func_ptr != NULL))
+    {
+        return sort_allocator.malloc_func_ptr(bytes, sort_allocator.user_data);
+    }
+    return malloc(bytes);
+}
+
+static inline void *sort_calloc(size_t count, size_t size)
+{
+    SORT_STATS_ADD(allocations, 1);
+    SORT_STATS_ADD(bytes_allocated, count * size);
+    if (SORT_UNLIKELY(sort_allocator.malloc_func_ptr != NULL))
+    {
+        if (SORT_UNLIKELY(size != 0 && count > (size_t)-1 / size))
+        {
+            return NULL;
+        }
+        void *ptr = sort_allocator.malloc_func_ptr(count * size, sort_allocator.user_data);
+        if (ptr != NULL)
+        {
+            memset(ptr, 0, count * size);
+        }
+        return ptr;
+    }
+    return calloc(count, size);
+}
+
+static inline void *sort_realloc(void *ptr, size_t bytes)
+{
+    SORT_STATS_ADD(allocations, 1);
+    SORT_STATS_ADD(bytes_allocated, bytes);
+    if (SORT_UNLIKELY(sort_allocator.malloc_func_ptr != NULL))
+    {
+        return sort_allocator.realloc_func_ptr(ptr, bytes, sort_allocator.user_data);
+    }
+    return realloc(ptr, bytes);
+}
+
+static inline void sort_free(void *ptr)
+{
+    if (SORT_UNLIKELY(sort_allocator.malloc_func_ptr != NULL))
+    {
+        sort_allocator.free_func_ptr(ptr, sort_allocator.user_data);
+        return;
+    }
+    free(ptr);
+}
+
+/* 스레드 진입 함수 선언용 매크로, 두 플랫폼 모두 'return 0;'으로 종료 가능 */
+#if defined(_WIN32)
+    #define SORT_THREAD_PROC unsigned __stdcall
+    typedef HANDLE SortThread;
+    typedef unsigned (__stdcall *SortThreadProc)(void *arg);
+#else
+    #define SORT_THREAD_PROC void *
+    typedef pthread_t SortThread;
+    typedef void *(*SortThreadProc)(void *arg);
+#endif
+
+/* 스레드 생성, 성공하면 0을 반환 */
+static inline int sort_thread_create(SortThread *thread, SortThreadProc proc, void *arg)
+{
+#if defined(_WIN32)
+    *thread = (HANDLE)_beginthreadex(NULL, 0, proc, arg, 0, NULL);
+    int result = (*thread != 0) ? 0 : -1;
+#else
+    int result = (pthread_create(thread, NULL, proc, arg) == 0) ? 0 : -1;
+#endif
+    if (result == 0)
+    {
+        SORT_STATS_ADD(thread_spawns, 1);
+    }
+    return result;
+}
+
+/* 스레드 종료 대기 및 핸들 정리 */
+static inline void sort_thread_join(SortThread thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+/* 종료를 기다리지 않을 스레드의 핸들 정리 (스레드는 계속 실행됨) */
+static inline void sort_thread_detach(SortThread thread)
+{
+#if defined(_WIN32)
+    CloseHandle(thread);
+#else
+    pthread_detach(thread);
+#endif
+}
+
+/* 뮤텍스와 조건 변수, 정적 변수는 SORT_MUTEX_INIT / SORT_COND_INIT으로 초기화 가능 */
+#if defined(_WIN32)
+    typedef SRWLOCK SortMutex;
+    typedef CONDITION_VARIABLE SortCond;
+    #define SORT_MUTEX_INIT SRWLOCK_INIT
+    #define SORT_COND_INIT CONDITION_VARIABLE_INIT
+#else
+    typedef pthread_mutex_t SortMutex;
+    typedef pthread_cond_t SortCond;
+    #define SORT_MUTEX_INIT PTHREAD_MUTEX_INITIALIZER
+    #define SORT_COND_INIT PTHREAD_COND_INITIALIZER
+#endif
+
+static inline void sort_mutex_init(SortMutex *mutex)
+{
+#if defined(_WIN32)
+    InitializeSRWLock(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static inline void sort_mutex_destroy(SortMutex *mutex)
+{
+#if defined(_WIN32)
+    (void)mutex; // SRWLOCK은 해제할 자원이 없음
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static inline void sort_mutex_lock(SortMutex *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static inline void sort_mutex_unlock(SortMutex *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static inline void sort_cond_init(SortCond *cond)
+{
+#if defined(_WIN32)
+    InitializeConditionVariable(cond);
+#else
+    pthread_cond_init(cond, NULL);
+#endif
+}
+
+static inline void sort_cond_destroy(SortCond *cond)
+{
+#if defined(_WIN32)
+    (void)cond;
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+/* mutex를 잠근 상태에서 호출, 깨어날 때까지 mutex를 풀고 대기 */
+static inline void sort_cond_wait(SortCond *cond, SortMutex *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+static inline void sort_cond_signal(SortCond *cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable(cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+static inline void sort_cond_broadcast(SortCond *cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+/* 작업 스레드 핸들과 생성 성공 여부 */
+typedef struct SortWorkerStruct
+{
+    SortThread thread;
+    int is_spawned;
+} SortWorker;
+
+/**
+ * proc를 num_workers개의 작업으로 실행하고 모두 끝날 때까지 대기
+ * args는 size_of_arg 크기의 인자 num_workers개가 연속된 배열이며, 0번 작업은 현재 스레드에서 처리
+ * 스레드 생성에 실패한 작업은 현재 스레드에서 순차 처리
+ */
+static inline void sort_run_workers(SortThreadProc proc, void *args, size_t size_of_arg, int num_workers)
+{
+    char *arg_ptr = (char *)args;
+    SortWorker *workers = (num_workers > 1) ? (SortWorker *)sort_malloc((size_t)num_workers * sizeof(SortWorker)) : NULL;
+    for (int t = 1; t < num_workers && workers != NULL; t++)
+    {
+        workers[t].is_spawned = (sort_thread_create(&workers[t].thread, proc, arg_ptr + t * size_of_arg) == 0);
+    }
+    proc(arg_ptr);
+    for (int t = 1; t < num_workers; t++)
+    {
+        if (SORT_LIKELY(workers != NULL && workers[t].is_spawned))
+        {
+            sort_thread_join(workers[t].thread);
+        }
+        else
+        {
+            proc(arg_ptr + t * size_of_arg);
+        }
+    }
+    sort_free(workers);
+}
+
+/* 단조 증가 시계 (밀리초) */
+static inline unsigned long long sort_now_ms(void)
+{
+#if defined(_WIN32)
+    return (unsigned long long)GetTickCount64();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000ULL + (unsigned long long)now.tv_nsec / 1000000ULL;
+#endif
+}
+
+/* 시간 측정용 고해상도 단조 시계 (초 단위) */
+static inline double sort_now_seconds(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+/* 시스템의 논리 프로세서 개수 반환 */
+static inline int sort_cpu_count(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    return (int)sysinfo.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (int)count : 1;
+#endif
+}
+
+/* 시스템에 맞는 적당한 작업 스레드 수 계산 (OS와 다른 작업을 위해 일부 코어를 남김), 튜닝 값에 지정되어 있으면 그 값을 사용 */
+static inline int sort_worker_count(void)
+{
+    int forced_count = sort_tuning_current()->num_threads;
+    if (forced_count > 0)
+    {
+        return forced_count;
+    }
+    int sys_cpu_count = sort_cpu_count();
+    return (sys_cpu_count >= 8) ? sys_cpu_count - 2 : ((sys_cpu_count >= 4) ? sys_cpu_count - 1 : sys_cpu_count);
+}
+
+/* --- merge_sort.c --- */
+
+/* 재귀 분할 정렬 (싱글 스레드), tmp_arr는 arr와 같은 인덱스 구간을 임시 공간으로 사용 */
+void internal_merge_sort(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr);
+
+/* 재귀 분할 정렬 (멀티 스레드), 구간 [left, right]를 num_threads개의 스레드로 정렬 */
+void internal_merge_sort_multi(void *SORT_RESTRICT arr, void *SORT_RESTRICT tmp_arr, size_t size_of_element, size_t left, size_t right, CmpFunc cmp_func_ptr, int num_threads);
+
+/* merge_sort_multi_ex와 같지만 스레드 수를 num_threads로 지정 (options는 NULL 가능) */
+int internal_merge_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, const SortOptions *options, int num_threads);
+
+#endif // SORT_INTERNAL_H
@@ -0,0 +1,61 @@
+/**
+ * @file sort_stats.c
+ * @brief 계측 빌드(SORT_STATS)의 카운터 구현부
+ *
+ * 라이브러리가 만드는 스레드는 정렬마다 생겼다 사라지므로 스레드별 카운터 대신
+ * 모든 스레드가 원자적으로 더하는 전역 카운터 하나를 사용
+ */
+
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+#if defined(SORT_STATS)
+
+SortStats sort_stats_counters;
+
+void sort_stats_count_swap(void)
+{
+    SORT_STATS_ADD(swaps, 1);
+}
+
+/* [공개 함수] 계측 카운터 복사 */
+int sort_stats_get(SortStats *out)
+{
+    if (SORT_UNLIKELY(out == NULL))
+    {
+        return -1;
+    }
+    out->comparisons = sort_atomic_fetch_add(&sort_stats_counters.comparisons, 0);
+    out->bytes_copied = sort_atomic_fetch_add(&sort_stats_counters.bytes_copied, 0);
+    out->swaps = sort_atomic_fetch_add(&sort_stats_counters.swaps, 0);
+    out->allocations = sort_atomic_fetch_add(&sort_stats_counters.allocations, 0);
+    out->bytes_allocated = sort_atomic_fetch_add(&sort_stats_counters.bytes_allocated, 0);
+    out->thread_spawns = sort_atomic_fetch_add(&sort_stats_counters.thread_spawns, 0);
+    return 0;
+}
+
+/* [공개 함수] 계측 카운터 초기화 */
+void sort_stats_reset(void)
+{
+    memset(&sort_stats_counters, 0, sizeof(sort_stats_counters));
+}
+
+#else
+
+/* [공개 함수] 계측 카운터 복사 (계측 없이 빌드됨) */
+int sort_stats_get(SortStats *out)
+{
+    if (out != NULL)
+    {
+        memset(out, 0, sizeof(SortStats));
+    }
+    return -1;
+}
+
+/* [공개 함수] 계측 카운터 초기화 (계측 없이 빌드됨) */
+void sort_stats_reset(void)
+{
+}
+
+#endif
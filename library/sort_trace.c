@@ -0,0 +1,243 @@
+/**
+ * @file sort_trace.c
+ * @brief 추적 빌드(SORT_TRACE)의 구간 기록과 Chrome trace-event JSON 저장 구현부
+ *
+ * 스레드마다 링 버퍼(슬롯) 하나를 혼자 사용하므로 기록할 때 잠금이 필요 없음
+ * 라이브러리의 스레드는 정렬마다 생겼다 사라지므로, 스레드가 끝나면 슬롯을 반납하여 다음 스레드가 이어서 사용
+ * (trace viewer에서는 슬롯 하나가 한 줄로 보임)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+#if defined(SORT_TRACE)
+
+/* 동시에 기록할 수 있는 최대 스레드 수와 스레드마다 보관할 최근 구간 수 (빌드 시 -D로 변경 가능) */
+#ifndef SORT_TRACE_MAX_THREADS
+#define SORT_TRACE_MAX_THREADS 256
+#endif
+#ifndef SORT_TRACE_CAPACITY
+#define SORT_TRACE_CAPACITY 16384
+#endif
+
+typedef struct SortTraceSpanStruct
+{
+    const char *name;
+    double start;               // sort_now_seconds 기준 (초)
+    double end;
+    size_t count;               // 구간이 다룬 원소 수
+} SortTraceSpan;
+
+typedef struct SortTraceSlotStruct
+{
+    volatile size_t in_use;     // 슬롯을 사용 중인 스레드가 있으면 1
+    size_t num_spans;           // 지금까지 기록한 구간 수, 용량을 넘으면 오래된 구간부터 덮어씀
+    SortTraceSpan *spans;       // 처음 사용할 때 할당하고 프로그램이 끝날 때까지 재사용
+} SortTraceSlot;
+
+static SortTraceSlot trace_slots[SORT_TRACE_MAX_THREADS];
+static volatile size_t dropped_spans;   // 빈 슬롯이 없어 버린 구간 수
+static volatile size_t is_key_created = 0;   // slot_key를 만든 뒤 release로 1을 기록
+static SortMutex key_mutex = SORT_MUTEX_INIT;
+#if defined(_WIN32)
+    static DWORD slot_key;
+#else
+    static pthread_key_t slot_key;
+#endif
+
+/* 슬롯을 넘겨받은 스레드가 이전 스레드의 기록을 모두 보도록 획득 / 해제 순서로 교체 (Interlocked 함수는 완전한 메모리 장벽) */
+static int claim_slot(SortTraceSlot *slot)
+{
+#if defined(_WIN32)
+    return sort_atomic_compare_exchange(&slot->in_use, 0, 1);
+#else
+    size_t expected = 0;
+    return __atomic_compare_exchange_n(&slot->in_use, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#endif
+}
+
+/* 스레드가 끝날 때 호출되어 슬롯 반납 */
+#if defined(_WIN32)
+static void NTAPI release_slot(void *value)
+#else
+static void release_slot(void *value)
+#endif
+{
+    if (value == NULL)
+    {
+        return;
+    }
+#if defined(_WIN32)
+    sort_atomic_compare_exchange(&((SortTraceSlot *)value)->in_use, 1, 0);
+#else
+    __atomic_store_n(&((SortTraceSlot *)value)->in_use, 0, __ATOMIC_RELEASE);
+#endif
+}
+
+static int create_key(void)
+{
+    if (SORT_LIKELY(sort_atomic_load_acquire(&is_key_created)))
+    {
+        return 0;
+    }
+    sort_mutex_lock(&key_mutex);
+    if (!sort_atomic_load_acquire(&is_key_created))
+    {
+#if defined(_WIN32)
+        slot_key = FlsAlloc(release_slot);
+        sort_atomic_store_release(&is_key_created, slot_key != FLS_OUT_OF_INDEXES);
+#else
+        sort_atomic_store_release(&is_key_created, pthread_key_create(&slot_key, release_slot) == 0);
+#endif
+    }
+    sort_mutex_unlock(&key_mutex);
+    return sort_atomic_load_acquire(&is_key_created) ? 0 : -1;
+}
+
+/* 현재 스레드의 슬롯, 처음 호출되면 빈 슬롯을 차지함 (없으면 NULL) */
+static SortTraceSlot *current_slot(void)
+{
+    if (SORT_UNLIKELY(create_key() != 0))
+    {
+        return NULL;
+    }
+#if defined(_WIN32)
+    SortTraceSlot *slot = (SortTraceSlot *)FlsGetValue(slot_key);
+#else
+    SortTraceSlot *slot = (SortTraceSlot *)pthread_getspecific(slot_key);
+#endif
+    if (SORT_LIKELY(slot != NULL))
+    {
+        return slot;
+    }
+    for (int i = 0; i < SORT_TRACE_MAX_THREADS; i++)
+    {
+        slot = &trace_slots[i];
+        if (!claim_slot(slot))
+        {
+            continue;
+        }
+        /* 추적용 메모리는 sort_malloc을 거치지 않아 계측 카운터와 교체한 할당 함수에 섞이지 않음 */
+        if (slot->spans == NULL)
+        {
+            slot->spans = (SortTraceSpan *)malloc(SORT_TRACE_CAPACITY * sizeof(SortTraceSpan));
+        }
+#if defined(_WIN32)
+        int is_set = (slot->spans != NULL && FlsSetValue(slot_key, slot));
+#else
+        int is_set = (slot->spans != NULL && pthread_setspecific(slot_key, slot) == 0);
+#endif
+        if (SORT_UNLIKELY(!is_set))
+        {
+            release_slot(slot);
+            return NULL;
+        }
+        return slot;
+    }
+    return NULL;
+}
+
+void sort_trace_record(const char *name, double start, size_t count)
+{
+    double end = sort_now_seconds();
+    SortTraceSlot *slot = current_slot();
+    if (SORT_UNLIKELY(slot == NULL))
+    {
+        sort_atomic_fetch_add(&dropped_spans, 1);
+        return;
+    }
+    SortTraceSpan *span = &slot->spans[slot->num_spans % SORT_TRACE_CAPACITY];
+    span->name = name;
+    span->start = start;
+    span->end = end;
+    span->count = count;
+    slot->num_spans++;
+}
+
+/* [공개 함수] 기록된 구간을 Chrome trace-event JSON으로 저장 */
+int sort_trace_dump(const char *path)
+{
+    if (SORT_UNLIKELY(path == NULL))
+    {
+        return -1;
+    }
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    /* 가장 이른 구간의 시작을 0으로 맞춤 */
+    double origin = 0.0;
+    int has_origin = 0;
+    size_t overwritten_spans = 0;
+    for (int i = 0; i < SORT_TRACE_MAX_THREADS; i++)
+    {
+        const SortTraceSlot *slot = &trace_slots[i];
+        size_t first = (slot->num_spans > SORT_TRACE_CAPACITY) ? slot->num_spans - SORT_TRACE_CAPACITY : 0;
+        overwritten_spans += first;
+        for (size_t s = first; s < slot->num_spans; s++)
+        {
+            double start = slot->spans[s % SORT_TRACE_CAPACITY].start;
+            if (!has_origin || start < origin)
+            {
+                origin = start;
+                has_origin = 1;
+            }
+        }
+    }
+
+    fprintf(file, "{\"traceEvents\": [");
+    const char *separator = "\n";
+    for (int i = 0; i < SORT_TRACE_MAX_THREADS; i++)
+    {
+        const SortTraceSlot *slot = &trace_slots[i];
+        if (slot->num_spans == 0)
+        {
+            continue;
+        }
+        fprintf(file, "%s  {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"sort thread %d\"}}", separator, i, i);
+        separator = ",\n";
+        size_t first = (slot->num_spans > SORT_TRACE_CAPACITY) ? slot->num_spans - SORT_TRACE_CAPACITY : 0;
+        for (size_t s = first; s < slot->num_spans; s++)
+        {
+            const SortTraceSpan *span = &slot->spans[s % SORT_TRACE_CAPACITY];
+            fprintf(file, ",\n  {\"name\": \"%s\", \"cat\": \"sort\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"n\": %llu}}",
+                    span->name, i, (span->start - origin) * 1e6, (span->end - span->start) * 1e6, (unsigned long long)span->count);
+        }
+    }
+    fprintf(file, "\n], \"displayTimeUnit\": \"ms\", \"otherData\": {\"dropped_spans\": %llu, \"overwritten_spans\": %llu}}\n",
+            (unsigned long long)sort_atomic_fetch_add(&dropped_spans, 0), (unsigned long long)overwritten_spans);
+
+    int has_error = ferror(file);
+    return (fclose(file) == 0 && !has_error) ? 0 : -1;
+}
+
+/* [공개 함수] 기록된 구간 삭제 */
+void sort_trace_reset(void)
+{
+    for (int i = 0; i < SORT_TRACE_MAX_THREADS; i++)
+    {
+        trace_slots[i].num_spans = 0;
+    }
+    dropped_spans = 0;
+}
+
+#else
+
+/* [공개 함수] 기록된 구간 저장 (추적 없이 빌드됨) */
+int sort_trace_dump(const char *path)
+{
+    (void)path;
+    return -1;
+}
+
+/* [공개 함수] 기록된 구간 삭제 (추적 없이 빌드됨) */
+void sort_trace_reset(void)
+{
+}
+
+#endif
@@ -5,7 +5,7 @@
  * 
  * void 포인터를 이용한 제네릭으로 구현되어 구조체를 포함하는 다양한 자료형 지원
  * 
- * @note Windows가 아닌 환경에서는 실행할 수 없음
+ * @note 멀티 스레드 정렬은 Windows에서는 Win32 스레드를, 그 외 환경에서는 POSIX 스레드(pthread)를 사용
  * 
  * */
 
@@ -33,6 +33,117 @@
 
 #define SWAP_BUF_SIZE 256
 
+/* 옵션을 받는 정렬 함수(_ex)의 반환값 */
+#define SORT_OK             0
+#define SORT_ERR_NOMEM     (-1)
+#define SORT_ERR_CANCELLED (-2)
+#define SORT_ERR_TIMEOUT   (-3)
+
+/**
+ * @brief 오래 걸리는 정렬을 중단하거나 진행 상황을 확인하기 위한 옵션
+ * 
+ * 병합 단계 사이(수만 개 단위)에서만 확인하므로 작은 구간의 정렬 속도에는 영향이 없음
+ * 중단되면 배열은 정렬되지 않았을 수 있지만 원소가 사라지지 않은 (입력의 순열) 상태로 남음
+ * progress_func_ptr는 호출한 스레드가 아닌 작업 스레드에서 호출될 수 있으므로, 호출한 스레드와 공유하는 데이터에 접근한다면 스레드 안전해야 함
+ * (라이브러리가 호출을 직렬화하므로 콜백끼리 겹치지는 않으며, 알리는 값은 항상 증가함)
+ * 
+ */
+typedef struct SortOptionsStruct
+{
+    volatile int *cancel_flag;  // NULL이 아니고 가리키는 값이 0이 아니게 되면 SORT_ERR_CANCELLED로 중단
+    unsigned long long timeout_ms; // 0이 아니면 정렬 시작 후 이 시간(ms)이 지났을 때 SORT_ERR_TIMEOUT으로 중단
+    void (*progress_func_ptr)(double fraction, void *user_data); // 완료된 병합 단계의 비율(0.0 ~ 1.0)을 알림, 작업 스레드에서 호출될 수 있음
+    void *user_data;            // progress_func_ptr에 그대로 전달
+} SortOptions;
+
+/* 키 명세 기반 정렬(sort_by_keys)에서 사용하는 키의 자료형 */
+typedef enum SortKeyTypeEnum
+{
+    SORT_KEY_INT8,
+    SORT_KEY_INT16,
+    SORT_KEY_INT32,
+    SORT_KEY_INT64,
+    SORT_KEY_UINT8,
+    SORT_KEY_UINT16,
+    SORT_KEY_UINT32,
+    SORT_KEY_UINT64,
+    SORT_KEY_FLOAT,
+    SORT_KEY_DOUBLE,
+    SORT_KEY_STRING     // 길이 length의 고정 크기 문자 배열, 널 문자까지 부호 없는 바이트 순서로 비교
+} SortKeyType;
+
+typedef enum SortDirectionEnum
+{
+    SORT_ASCENDING,
+    SORT_DESCENDING
+} SortDirection;
+
+/**
+ * @brief 구조체 안의 정렬 키 하나에 대한 명세
+ *
+ * 예) Student를 점수 내림차순, 같은 점수는 학번 오름차순으로 정렬
+ * SortKey keys[2] = {{offsetof(Student, score), SORT_KEY_DOUBLE, SORT_DESCENDING, 0},
+ *                    {offsetof(Student, id), SORT_KEY_INT32, SORT_ASCENDING, 0}};
+ *
+ */
+typedef struct SortKeyStruct
+{
+    size_t offset;          // 원소 시작 위치로부터 키까지의 바이트 수 (offsetof)
+    SortKeyType type;
+    SortDirection direction;
+    size_t length;          // SORT_KEY_STRING일 때 문자 배열의 크기, 그 외에는 무시
+} SortKey;
+
+/**
+ * @brief 병렬화와 삽입 정렬 전환 기준 등 하드웨어에 따라 달라지는 튜닝 값
+ *
+ * 기본값은 일반적인 데스크톱 기준이며, sort_calibrate로 현재 시스템에 맞게 측정 가능
+ *
+ */
+typedef struct SortTuningStruct
+{
+    size_t parallel_threshold;  // 병렬 처리를 수행할 최소 데이터 개수 (기본 16384)
+    size_t insertion_cutoff;    // 병합 정렬에서 이 개수 이하의 구간은 이진 삽입 정렬로 처리 (기본 16, 1이면 끄기)
+    int num_threads;            // 작업 스레드 수, 0이면 코어 수에 따라 자동 (기본 0)
+    size_t wide_element;        // 자동 정렬에서 원소 크기가 이보다 크면 merge_sort_pp 사용 (기본 64)
+    size_t auto_insertion_limit; // 자동 정렬에서 원소 수가 이 값 이하이면 이진 삽입 정렬 사용 (기본 32)
+    size_t auto_few_unique_permille; // 자동 정렬의 표본에서 서로 다른 값의 비율(천분율)이 이 값 이하이면 sort_few_unique 사용 (기본 125, 1이면 끄기)
+} SortTuning;
+
+/**
+ * @brief 계측 빌드(SORT_STATS 정의)에서 정렬 함수들이 누적하는 횟수
+ *
+ * 모든 스레드의 값이 하나로 합산되므로, 정렬 한 번의 값을 보려면 sort_stats_reset 후 정렬하고 sort_stats_get 호출
+ *
+ */
+typedef struct SortStatsStruct
+{
+    size_t comparisons;     // 비교 함수 호출 수
+    size_t bytes_copied;    // memcpy / memmove로 옮긴 바이트 수 (generic_swap 제외)
+    size_t swaps;           // generic_swap 호출 수
+    size_t allocations;     // 메모리 할당 횟수
+    size_t bytes_allocated; // 할당한 바이트 수의 합
+    size_t thread_spawns;   // 생성한 스레드 수
+} SortStats;
+
+/**
+ * @brief 라이브러리가 작업 공간(임시 버퍼, 스레드 인자 등)을 할당할 때 사용할 함수들
+ *
+ * 세 함수를 모두 지정해야 하며, user_data는 각 함수에 그대로 전달됨
+ *
+ */
+typedef struct SortAllocatorStruct
+{
+    void *(*malloc_func_ptr)(size_t bytes, void *user_data);
+    void *(*realloc_func_ptr)(void *ptr, size_t bytes, void *user_data);
+    void (*free_func_ptr)(void *ptr, void *user_data);
+    void *user_data;
+} SortAllocator;
+
+#if defined(SORT_STATS)
+void sort_stats_count_swap(void);
+#endif
+
 /* 다양한 정렬에 사용되는 swap 함수 */
 static inline void generic_swap(void *a_ptr, void *b_ptr, size_t size_of_element)
 {
@@ -40,6 +151,9 @@ static inline void generic_swap(void *a_ptr, void *b_ptr, size_t size_of_element
     {
         return;
     }
+#if defined(SORT_STATS)
+    sort_stats_count_swap();
+#endif
     if (SORT_LIKELY(size_of_element <= SWAP_BUF_SIZE))
     {
         char tmp[SWAP_BUF_SIZE];
@@ -101,6 +215,86 @@ int merge_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*
 int merge_sort_multi(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
 
 
+/**
+ * @brief 옵션(취소, 제한 시간, 진행률)을 받는 싱글 스레드 병합 정렬
+ * 
+ * @param options NULL이면 merge_sort와 같음
+ * 
+ * @return SORT_OK, 메모리 할당 실패 시 SORT_ERR_NOMEM, 취소되면 SORT_ERR_CANCELLED, 시간 초과 시 SORT_ERR_TIMEOUT
+ * 
+ */
+int merge_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options);
+
+
+/**
+ * @brief 옵션(취소, 제한 시간, 진행률)을 받는 멀티 스레드 병합 정렬
+ * 
+ * 취소되거나 시간이 초과되면 모든 작업 스레드가 다음 확인 지점에서 멈추고 반환함
+ * 
+ * @param options NULL이면 merge_sort_multi와 같음
+ * 
+ * @return SORT_OK, 메모리 할당 실패 시 SORT_ERR_NOMEM, 취소되면 SORT_ERR_CANCELLED, 시간 초과 시 SORT_ERR_TIMEOUT
+ * 
+ */
+int merge_sort_multi_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options);
+
+
+/* 비동기 정렬 요청 핸들 (내부 구조는 sort_async.c에만 공개) */
+typedef struct SortHandleStruct SortHandle;
+
+/**
+ * @brief 비동기 정렬 요청
+ * 
+ * 라이브러리의 작업 스레드 풀(처음 호출 시 생성)에서 정렬을 수행하고 바로 반환함
+ * 큰 요청은 merge_sort_multi_ex처럼 멀티 스레드로 정렬하되 동시에 실행 중인 큰 요청끼리 스레드 수를 나누고,
+ * 작은 요청은 연속된 작은 요청들과 묶어 한 작업 스레드에서 임시 버퍼를 공유하여 처리
+ * 풀의 스레드(sort_worker_count()개)는 프로세스가 끝날 때까지 남아 있으며 종료하거나 회수하는 함수는 없음
+ * 완료될 때까지 arr를 읽거나 쓰면 안 되며, 다 쓴 핸들은 sort_handle_release로 반환해야 함
+ * 
+ * @param options NULL 가능, 내용은 복사되지만 cancel_flag가 가리키는 값은 완료 시까지 유효해야 함
+ * 
+ * @return 요청 핸들, 핸들 할당에 실패하면 NULL
+ * 
+ */
+SortHandle *sort_async(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), const SortOptions *options);
+
+
+/**
+ * @brief 비동기 정렬이 끝날 때까지 대기
+ * 
+ * @return merge_sort_multi_ex와 같은 반환값 (SORT_OK, SORT_ERR_*)
+ * 
+ */
+int sort_wait(SortHandle *handle);
+
+
+/**
+ * @brief 대기하지 않고 비동기 정렬 완료 여부 확인
+ * 
+ * @return 끝났으면 1을 반환하고 result가 NULL이 아니면 결과를 기록, 아직이면 0을 반환
+ * 
+ */
+int sort_try_wait(SortHandle *handle, int *result);
+
+
+/**
+ * @brief 비동기 정렬 완료 시 호출할 콜백 등록
+ * 
+ * 작업 스레드에서 호출되며, 이미 끝났으면 등록하는 스레드에서 바로 호출됨
+ * 
+ */
+void sort_on_complete(SortHandle *handle, void (*complete_func_ptr)(int result, void *user_data), void *user_data);
+
+
+/**
+ * @brief 비동기 정렬 핸들 반환
+ * 
+ * 정렬이 끝나기 전에 반환해도 되며, 이 경우 정렬이 끝난 뒤 자동으로 해제됨
+ * 
+ */
+void sort_handle_release(SortHandle *handle);
+
+
 /**
  * @brief 더블 버퍼링 이용 멀티 스레드 병합 정렬
  * 
@@ -110,6 +304,459 @@ int merge_sort_multi(void *arr, size_t num_of_elements, size_t size_of_element,
 int merge_sort_pp(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
 
 
+/**
+ * @brief NUMA 인지 멀티 스레드 병합 정렬
+ * 
+ * 노드마다 스레드를 해당 노드 CPU에 고정하고, 각 노드가 배열 조각을 자신이 처음 기록한(노드 로컬) 버퍼에서 정렬한 뒤
+ * 모든 노드의 스레드가 나눠서 노드 간 병합을 수행하여 여러 소켓의 메모리 대역폭을 함께 사용
+ * 토폴로지는 SORT_USE_LIBNUMA 정의 시 libnuma로(-lnuma 링크 필요), 아니면 Linux sysfs 또는 Win32 API로 조회하며
+ * 노드가 하나뿐이면 merge_sort_multi와 같음
+ * 
+ * @note 원소 수만큼의 버퍼를 두 개 사용하므로 merge_sort_multi보다 메모리를 한 배 더 사용
+ * 
+ * @return 정렬에 필요한 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ * 
+ */
+int merge_sort_numa(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 멀티 스레드 샘플 정렬
+ * 
+ * 표본에서 고른 분할자로 스레드 수만큼의 버킷에 병렬 분산한 뒤, 각 버킷을 싱글 스레드 병합 정렬로 독립 정렬
+ * 최상위 병합이 없어 코어 수가 많을수록 merge_sort_multi보다 잘 확장되며,
+ * 분할자와 같은 원소는 별도 버킷으로 모아 중복이 많은 입력에서도 버킷 크기가 고르게 유지됨 (안정 정렬)
+ * 
+ * @return 정렬에 필요한 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ * 
+ */
+int sample_sort_multi(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 중복이 많은 입력용 정렬 (상태 코드처럼 서로 다른 값이 적은 키, 안정 정렬)
+ *
+ * 표본에서 서로 다른 값의 수를 확인하여 적으면, 그 값들을 정렬된 표로 만들고 각 원소를 이진 탐색으로 분류한 뒤
+ * 값 순서대로 안정 분산함 (원소당 비교 log2(서로 다른 값의 수)회, 이동 2회)
+ * 표본에 없던 드문 값은 표의 값 사이 구간으로 모아 따로 정렬하므로 결과는 항상 올바르며,
+ * 표본에서 서로 다른 값이 많으면 merge_sort_multi로 정렬
+ *
+ * @return 정렬에 필요한 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int sort_few_unique(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+/**
+ * @brief 정렬 후 같은 원소를 하나로 합치고 각 값의 개수를 기록
+ *
+ * sort_few_unique로 정렬한 뒤, 같은 값 구간마다 (입력 순서상) 첫 원소만 배열 앞쪽에 남김
+ * out_num_of_elements 이후의 원소는 정의되지 않음
+ *
+ * @param counts NULL이 아니면 counts[i]에 i번째 남은 원소와 같은 원소의 수를 기록 (num_of_elements개 이상의 공간 필요)
+ * @param out_num_of_elements 남은 (서로 다른) 원소의 수를 기록
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 배열은 정렬되지 않았을 수 있음), 성공하면 0을 반환
+ *
+ */
+int sort_and_count(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *counts, size_t *out_num_of_elements);
+
+/**
+ * @brief 중복 제거 정렬: 정렬하면서 같은 원소를 하나만 남김
+ *
+ * 병합 정렬의 모든 병합 단계에서 같은 원소를 제거하므로 정렬 후 별도의 중복 제거 과정이 필요 없고,
+ * 중복이 많을수록 위 단계의 병합 대상이 줄어듦
+ * 같은 원소 중 입력 순서상 처음 나온 원소가 남으며, out_num_of_elements 이후의 원소는 정의되지 않음
+ *
+ * @param out_num_of_elements 남은 (서로 다른) 원소의 수를 기록
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 배열은 변경되지 않음), 성공하면 0을 반환
+ *
+ */
+int sort_unique(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *out_num_of_elements);
+
+
+/* 자동 정렬(auto_sort)이 고를 수 있는 정렬 엔진 */
+typedef enum SortEngineEnum
+{
+    SORT_ENGINE_NONE,               // 이미 정렬되어 있음
+    SORT_ENGINE_REVERSE,            // 엄격한 역순이므로 뒤집기만 함
+    SORT_ENGINE_INSERTION_BINARY,
+    SORT_ENGINE_MERGE,
+    SORT_ENGINE_MERGE_MULTI,
+    SORT_ENGINE_MERGE_PP,
+    SORT_ENGINE_FEW_UNIQUE,
+    SORT_ENGINE_MERGE_RUNS          // 오름차순 구간이 몇 개뿐이므로 구간끼리만 병합
+} SortEngine;
+
+/* 자동 정렬의 표본 조사 결과와 선택한 엔진 (진단용) */
+typedef struct SortDecisionStruct
+{
+    SortEngine engine;
+    size_t num_of_elements;
+    size_t size_of_element;
+    double sorted_ratio;        // 표본 이웃 원소 쌍 중 순서가 맞는 비율 (0.0 ~ 1.0)
+    size_t num_runs;            // 표본이 거의 정렬되어 전체를 훑었을 때의 오름차순 구간 수 (훑지 않았거나 구간이 너무 많으면 0)
+    double duplicate_ratio;     // 표본 중 다른 원소와 중복인 원소의 비율 (0.0 ~ 1.0)
+    int num_threads;            // 사용할 스레드 수
+    const char *reason;         // 선택 이유 (정적 문자열)
+} SortDecision;
+
+/**
+ * @brief 자동 정렬: 입력을 표본 조사하여 알맞은 정렬 엔진으로 정렬 (안정 정렬)
+ *
+ * 작은 입력은 이진 삽입 정렬, 이미 정렬된 입력은 그대로, 엄격한 역순은 뒤집기, 오름차순 구간이 몇 개뿐이면 구간끼리 병합,
+ * 중복이 많으면 sort_few_unique, 큰 입력은 멀티 스레드 병합 정렬(원소가 크면 merge_sort_pp)을 사용
+ * 표본 조사 비용은 원소 수와 관계없이 비교 수백 회 수준이며, 표본이 거의 정렬된 경우에만 전체를 한 번 훑어 구간 수를 셈
+ *
+ * @return 정렬에 필요한 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int auto_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+/**
+ * @brief 선택 결과를 돌려주는 자동 정렬
+ *
+ * @param decision NULL이 아니면 표본 조사 결과와 선택한 엔진을 기록
+ *
+ */
+int auto_sort_ex(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), SortDecision *decision);
+
+/**
+ * @brief 자동 정렬이 엔진을 고를 때마다 호출할 기록 함수 등록 (NULL이면 해제)
+ *
+ * 정렬을 호출한 스레드에서 정렬 전에 호출됨
+ * 다른 스레드에서 정렬이 진행 중일 때 바꿔도 되며, 진행 중인 정렬은 이전 기록 함수와 user_data의 쌍을 그대로 사용할 수 있음
+ *
+ */
+void auto_sort_set_logger(void (*log_func_ptr)(const SortDecision *decision, void *user_data), void *user_data);
+
+/**
+ * @brief 엔진 이름 문자열 (예: "merge_sort_multi")
+ */
+const char *sort_engine_name(SortEngine engine);
+
+/**
+ * @brief 현재 적용 중인 튜닝 값을 out에 복사
+ *
+ * 처음 사용될 때 환경 변수 SORT_TUNING_FILE이 가리키는 파일을 읽고, 환경 변수나 파일이 없으면 기본값을 사용
+ * 작업 디렉터리의 파일은 자동으로 읽지 않음 (빌드 시 SORT_TUNING_DEFAULT_PATH를 정의하면 환경 변수가 없을 때 그 파일을 읽음)
+ *
+ */
+void sort_get_tuning(SortTuning *out);
+
+/**
+ * @brief 튜닝 값 변경 (NULL이면 기본값으로 되돌림)
+ *
+ * 0인 값은 기본값을 사용하며(num_threads는 자동), 정렬이 진행 중이지 않을 때 호출해야 함
+ *
+ */
+void sort_set_tuning(const SortTuning *tuning);
+
+/**
+ * @brief 멀티 스레드 정렬의 작업 스레드 수 고정 (0 이하면 코어 수에 따라 자동)
+ *
+ * 튜닝 값의 num_threads만 바꾸며, 정렬이 진행 중이지 않을 때 호출해야 함
+ * parallel_threshold보다 작은 구간은 더 나누지 않으므로 작은 데이터에서는 실제로 쓰이는 스레드가 더 적을 수 있음
+ *
+ */
+void sort_set_thread_count(int num_threads);
+
+/**
+ * @brief 멀티 스레드 정렬이 사용할 작업 스레드 수 (고정하지 않았으면 코어 수로 정한 값)
+ */
+int sort_get_thread_count(void);
+
+/**
+ * @brief 보정 실행: 현재 시스템에서 튜닝 값마다 여러 후보로 정렬 시간을 측정하여 가장 빠른 값을 out에 기록
+ *
+ * 고정 시드 난수 int 배열(최대 2^21개)을 후보마다 3회 정렬하여 최솟값을 비교하므로 수 초가 걸릴 수 있음
+ * 자동 정렬의 기준도 측정함 (작은 배열에서 이진 삽입 정렬이 이기는 크기, 서로 다른 키 수에 따라 sort_few_unique가 이기는 중복 비율)
+ * 측정 중에는 튜닝 값을 바꿔 가며 정렬하므로 다른 스레드에서 정렬을 호출하지 않아야 하며,
+ * 끝나면 이전 튜닝 값을 되돌림 (측정 결과를 적용하려면 sort_set_tuning, 저장하려면 sort_tuning_save 호출)
+ *
+ * @return 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int sort_calibrate(SortTuning *out);
+
+/**
+ * @brief 튜닝 값을 "이름 = 값" 형식의 텍스트 파일로 저장
+ *
+ * @return 파일을 열거나 쓸 수 없으면 -1을, 성공하면 0을 반환
+ *
+ */
+int sort_tuning_save(const char *path, const SortTuning *tuning);
+
+/**
+ * @brief sort_tuning_save로 저장한 파일을 읽어 out에 기록
+ *
+ * 파일에 없는 항목은 기본값을 사용하고, '#'으로 시작하는 줄과 알 수 없는 이름은 무시
+ *
+ * @return 파일을 열 수 없으면 -1을, 성공하면 0을 반환
+ *
+ */
+int sort_tuning_load(const char *path, SortTuning *out);
+
+/**
+ * @brief 계측 카운터를 out에 복사
+ *
+ * @return SORT_STATS 없이 빌드되었으면 out을 0으로 채우고 -1을, 그 외에는 0을 반환
+ *
+ */
+int sort_stats_get(SortStats *out);
+
+/**
+ * @brief 계측 카운터를 0으로 초기화 (정렬이 진행 중이지 않을 때 호출)
+ */
+void sort_stats_reset(void);
+
+/**
+ * @brief 추적 빌드(SORT_TRACE 정의)에서 기록한 병합 정렬의 단계별 구간을 Chrome trace-event JSON으로 저장
+ *
+ * 메모리 할당, 초기 복사, 스레드마다의 순차 정렬, 병렬 병합 단계, 스레드 생성과 대기 시간이 스레드별로 기록되며,
+ * chrome://tracing이나 Perfetto에서 열 수 있음 (스레드마다 최근 구간만 보관, 정렬이 진행 중이지 않을 때 호출)
+ *
+ * @return SORT_TRACE 없이 빌드되었거나 파일을 쓸 수 없으면 -1을, 성공하면 0을 반환
+ *
+ */
+int sort_trace_dump(const char *path);
+
+/**
+ * @brief 기록된 구간을 모두 삭제 (정렬이 진행 중이지 않을 때 호출)
+ */
+void sort_trace_reset(void);
+
+/**
+ * @brief 작업 공간 할당 함수 교체 (NULL이거나 함수가 하나라도 NULL이면 표준 malloc / realloc / free로 되돌림)
+ *
+ * 메모리 사용량 측정이나 전용 메모리 풀에 사용하며, 진행 중인 정렬이 할당한 메모리를 다른 함수로 해제하게 되므로
+ * 정렬이 진행 중이지 않을 때 호출해야 함 (비동기 정렬 포함)
+ *
+ */
+void sort_set_allocator(const SortAllocator *allocator);
+
+
+/**
+ * @brief 묶음 정렬: 서로 독립인 여러 배열을 한 번에 정렬 (안정 정렬)
+ * 
+ * 배열을 크기 구간별로 모아 처리하며, 16개 이하는 삽입 정렬, 64개 이하는 이진 삽입 정렬, 그보다 크면 병합 정렬을 사용
+ * 예상 비용이 고르게 나뉘도록 배열들을 여러 스레드에 분배하고, 스레드마다 임시 버퍼를 한 번만 할당하여 공유함
+ * 
+ * @param arrays 정렬할 배열들의 포인터 목록
+ * @param counts arrays[i]의 원소 수 목록
+ * @param num_arrays 배열 수
+ * 
+ * @return 임시 버퍼 할당에 실패하면 -1을 (이 경우 일부 큰 배열은 정렬되지 않았을 수 있음), 성공하면 0을 반환
+ * 
+ */
+int sort_batch(void **arrays, const size_t *counts, size_t num_arrays, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 구간별 정렬: 하나의 버퍼를 offsets 경계로 나눈 각 구간을 제자리에서 독립적으로 정렬 (안정 정렬)
+ *
+ * 64개 이하의 구간은 이진 삽입 정렬, 그보다 크면 병합 정렬을 사용하며 구간마다 메모리를 할당하지 않음
+ * 연속된 구간들을 예상 비용이 고르게 나뉘도록 여러 스레드에 분배하고,
+ * 스레드 하나의 몫보다 긴 구간은 마지막에 모든 스레드를 사용해 정렬
+ *
+ * @param offsets 구간 경계 목록 (num_segments + 1개), i번째 구간은 [offsets[i], offsets[i + 1])이며 오름차순이어야 함
+ * @param num_segments 구간 수
+ *
+ * @return 임시 버퍼 할당에 실패하면 -1을 (이 경우 일부 긴 구간은 정렬되지 않았을 수 있음), 성공하면 0을 반환
+ *
+ */
+int segmented_sort(void *arr, const size_t *offsets, size_t num_segments, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 키-값 정렬: 키 배열 기준으로 정렬하고, 분리된 값 배열도 같은 순서로 재배치 (안정 정렬)
+ *
+ * 비교 함수에는 키 원소의 포인터가 전달되며, 값 배열은 정렬이 끝난 뒤 한 번만 이동함
+ *
+ * @param keys 키 배열
+ * @param values 키와 같은 원소 수를 갖는 값 배열, NULL이면 키만 정렬
+ * @param size_of_key 키 원소 하나의 크기
+ * @param size_of_value 값 원소 하나의 크기
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 두 배열 모두 변경되지 않음), 성공하면 0을 반환
+ *
+ */
+int sort_pairs(void *keys, void *values, size_t num_of_elements, size_t size_of_key, size_t size_of_value, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+/**
+ * @brief 열 정렬: 키 배열 기준으로 정렬하고, 여러 값 열도 같은 순서로 재배치 (안정 정렬)
+ *
+ * 키와 원래 위치만 담은 레코드를 병합 정렬한 뒤 각 열을 위치 목록 순서로 한 번씩 모아 옮기므로,
+ * 열의 수나 크기와 관계없이 비교와 병합 단계의 메모리 이동은 키 크기로 제한됨
+ *
+ * @param columns 값 열 목록, 각 열은 num_of_elements개의 원소를 가짐 (NULL인 열은 건너뜀)
+ * @param column_sizes columns[i]의 원소 하나의 크기
+ * @param num_columns 열 수
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 키와 모든 열이 변경되지 않음), 성공하면 0을 반환
+ *
+ */
+int sort_columns(void *keys, size_t num_of_elements, size_t size_of_key, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), void **columns, const size_t *column_sizes, size_t num_columns);
+
+
+/**
+ * @brief 키 명세 기반 다중 키 정렬: 비교 함수 없이 SortKey 목록 순서대로 비교 (안정 정렬)
+ *
+ * 키들을 바이트 순서가 곧 정렬 순서인 정규화 키로 바꾼 뒤 바이트 단위 LSD 기수 정렬로 정렬하고,
+ * 원소는 마지막에 한 번만 이동함 (모든 원소가 같은 값인 바이트 단계는 건너뜀)
+ * 부동 소수점 키에서 -0.0과 0.0은 같은 값으로 취급
+ *
+ * @param keys 우선순위 순서의 키 명세 목록
+ * @param num_keys 키 명세 수
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 배열은 변경되지 않음), 성공하면 0을 반환
+ *
+ */
+int sort_by_keys(void *arr, size_t num_of_elements, size_t size_of_element, const SortKey *keys, size_t num_keys);
+
+/**
+ * @brief 키 명세 목록으로 만든 정규화 키의 바이트 수
+ */
+size_t sort_key_width(const SortKey *keys, size_t num_keys);
+
+/**
+ * @brief 원소 하나의 정규화 키를 out에 기록
+ *
+ * 두 원소의 정규화 키를 memcmp로 비교한 결과가 키 명세에 따른 비교 결과와 같음
+ *
+ * @param out sort_key_width(keys, num_keys) 바이트 이상의 버퍼
+ *
+ */
+void sort_key_normalize(const SortKey *keys, size_t num_keys, const void *element, unsigned char *out);
+
+/**
+ * @brief 키 명세에 따라 두 원소를 비교
+ *
+ * @return a가 앞이면 음수, 같으면 0, a가 뒤면 양수를 반환
+ *
+ */
+int sort_key_compare(const SortKey *keys, size_t num_keys, const void *a_ptr, const void *b_ptr);
+
+
+/**
+ * @brief 문자열 정렬: C 문자열 포인터 배열을 strcmp 순서로 정렬 (멀티 스레드 다중 키 퀵 정렬)
+ *
+ * 한 번에 문자 하나로 3-way 분할하여 공통 접두사를 다시 비교하지 않으므로,
+ * 접두사가 긴 문자열(호스트 이름, URL 등)에서 strcmp 비교 함수를 쓰는 병합 정렬보다 문자 비교 수가 크게 적음
+ * 내용이 같은 문자열 포인터끼리의 순서는 유지되지 않음
+ *
+ * @param strs 널 문자로 끝나는 문자열의 포인터 배열
+ *
+ */
+void string_sort(char **strs, size_t num_of_elements);
+
+/**
+ * @brief 구조체 안의 고정 크기 문자 배열(예: char name[32]) 기준 정렬 (안정 정렬)
+ *
+ * 필드 포인터 배열을 다중 키 퀵 정렬로 정렬한 뒤 원소를 한 번만 이동
+ * 필드는 널 문자나 width 바이트 중 먼저 나오는 곳에서 끝나는 것으로 봄
+ *
+ * @param offset 원소 시작 위치로부터 문자 배열까지의 바이트 수 (offsetof)
+ * @param width 문자 배열의 크기
+ *
+ * @return 메모리 할당에 실패하면 -1을 (이 경우 배열은 변경되지 않음), 성공하면 0을 반환
+ *
+ */
+int string_sort_field(void *arr, size_t num_of_elements, size_t size_of_element, size_t offset, size_t width);
+
+/**
+ * @brief LCP 병합 정렬: C 문자열 포인터 배열을 strcmp 순서로 정렬 (멀티 스레드 병합 정렬, 안정 정렬)
+ *
+ * 병합할 때 이웃한 문자열의 최장 공통 접두사(LCP) 길이를 임시 배열에 함께 유지하여,
+ * LCP가 다르면 문자를 비교하지 않고 같을 때도 공통 접두사 이후부터만 비교
+ * 접두사가 긴 문자열 집합에서 strcmp 비교 함수를 쓰는 merge_sort보다 문자 비교 수가 크게 줄어듦
+ *
+ * @param strs 널 문자로 끝나는 문자열의 포인터 배열
+ *
+ * @return 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ *
+ */
+int merge_sort_strings(char **strs, size_t num_of_elements);
+
+
+/**
+ * @brief n번째 원소 선택 (Introselect)
+ * 
+ * 배열 전체를 정렬하지 않고 nth 위치에 정렬했을 때 올 원소를 배치함
+ * 앞쪽 원소는 모두 nth 원소보다 작거나 같고, 뒤쪽 원소는 모두 크거나 같음
+ * 분할이 계속 치우치면 median-of-medians 피벗으로 전환하여 최악의 경우에도 O(N)
+ * 
+ */
+void nth_element(void *arr, size_t num_of_elements, size_t nth, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 여러 순위 동시 선택 (p50, p99 등 여러 분위수를 한 번에 구할 때 사용)
+ * 
+ * 분할할 때마다 순위 목록을 양쪽으로 나누어 필요한 구간만 계속 선택함
+ * 
+ * @param ranks 찾을 순위 목록, 오름차순으로 정렬되어 있어야 하며 num_of_elements 이상인 순위는 무시됨
+ * 
+ */
+void nth_element_ranks(void *arr, size_t num_of_elements, const size_t *ranks, size_t num_ranks, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 멀티 스레드 n번째 원소 선택
+ * 
+ * 병렬 3-way 분할로 구간을 줄이다가 구간이 작아지면 순차 선택으로 전환
+ * 
+ * @return 분할에 필요한 메모리 할당에 실패하면 -1을, 성공하면 0을 반환
+ * 
+ */
+int nth_element_multi(void *arr, size_t num_of_elements, size_t nth, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 정렬 여부 확인 (멀티 스레드)
+ *
+ * 배열을 스레드 수만큼 나눠 모든 인접한 두 원소를 비교하며, 어긋난 곳을 찾으면 다른 스레드도 곧 멈춤
+ *
+ * @return 오름차순(같은 값 허용)이면 1을, 아니면 0을 반환
+ *
+ */
+int sort_is_sorted(const void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
+/**
+ * @brief 기본 자료형 배열의 정렬 여부 확인 (멀티 스레드, 비교 함수 없이 SIMD로 벡터화되는 반복문 사용)
+ *
+ * 배열은 key_type 자료형의 정렬(alignment)을 따라야 하며, 실수의 NaN은 검사하지 않음
+ *
+ * @return 오름차순이면 1을, 아니면 0을, SORT_KEY_STRING처럼 지원하지 않는 자료형이면 -1을 반환
+ *
+ */
+int sort_is_sorted_key(const void *arr, size_t num_of_elements, SortKeyType key_type);
+
+
+/**
+ * @brief 원소 순서와 무관한 64비트 체크섬 (멀티 스레드)
+ *
+ * 원소마다 모든 바이트(구조체 패딩 포함)의 해시를 구해 더하므로, 정렬 전후의 값이 같으면 결과가 입력의 순열임을 확인할 수 있음
+ * (원소가 사라지거나 중복되면 2^-64 정도의 확률을 제외하고 값이 달라짐)
+ *
+ */
+unsigned long long sort_checksum(const void *arr, size_t num_of_elements, size_t size_of_element);
+
+
+/**
+ * @brief sorted가 original을 안정 정렬한 결과인지 확인
+ *
+ * 안정 정렬의 결과는 하나뿐이므로, 같은 원소는 원래 위치로 순서를 정해 인덱스를 힙 정렬한 기준과 바이트 단위로 비교함
+ * 기준은 라이브러리의 병합 코드를 쓰지 않으므로 병합 정렬 계열 엔진도 검증할 수 있음
+ * (순열 여부와 정렬 여부도 함께 확인되며, 원소 n개와 인덱스 n개만큼의 메모리와 싱글 스레드 힙 정렬 한 번의 시간이 더 필요함)
+ *
+ * @return 같으면 1을, 다르면 0을, 메모리 할당에 실패하면 -1을 반환
+ *
+ */
+int sort_verify_stable(const void *original, const void *sorted, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+
 /**
  * @brief 보고 정렬
  * 
@@ -137,8 +784,23 @@ typedef struct GulagStruct
  * 기존 배열에는 정렬된 원소만 남음
  * 
  * @return 굴라그 배열의 주소 포인터 (void *)location과 숙청당한 원소의 수 size_t count를 갖는 구조체 포인터를 반환
+ *         (location과 구조체는 sort_set_allocator와 관계없이 malloc으로 할당되므로 호출자가 free로 해제)
  * 
  */
 Gulag *stalin_sort(void *arr, size_t num_of_elements, size_t size_of_element, int (*purge_func_ptr)(const void *a_ptr, const void *b_ptr));
 
+/**
+ * @brief 중복 제거 정렬 (감사용): sort_unique와 같지만 제거된 원소를 굴라그 배열로 보냄
+ *
+ * 기존 배열에는 정렬된 서로 다른 원소만 남음
+ *
+ * @param out_num_of_elements 남은 (서로 다른) 원소의 수를 기록
+ *
+ * @return 굴라그 배열의 주소 포인터 (void *)location과 제거된 원소의 수 size_t count를 갖는 구조체 포인터를 반환,
+ *         메모리 할당에 실패하면 NULL을 반환 (이 경우 배열은 변경되지 않음)
+ *         location과 구조체는 sort_set_allocator와 관계없이 malloc으로 할당되므로 호출자가 free로 해제
+ *
+ */
+Gulag *sort_unique_gulag(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *out_num_of_elements);
+
 #endif // SORTING_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "sorting.h"
+#include "sort_internal.h"
 
 static void compress_arr(void *SORT_RESTRICT arr, int *is_purged, size_t num_of_elements, size_t size_of_element);
 
@@ -16,8 +17,12 @@ Gulag *stalin_sort(void *arr, size_t num_of_elements, size_t size_of_element, in
     {
         return NULL;
     }
-    /* 수용소 할당 후 청소(calloc) */
+    /* 수용소 할당 후 청소(calloc), 호출자가 free로 해제하므로 교체한 할당 함수(sort_set_allocator)를 거치지 않음 */
     Gulag *gulag = (Gulag *)calloc(1, sizeof(Gulag));
+    if (SORT_UNLIKELY(gulag == NULL))
+    {
+        return NULL;
+    }
     gulag->location = malloc(num_of_elements * size_of_element);
     if (SORT_UNLIKELY(gulag->location == NULL))
     {
@@ -27,7 +32,7 @@ Gulag *stalin_sort(void *arr, size_t num_of_elements, size_t size_of_element, in
 
     void *current_gulag_ptr = gulag->location;
     /* 숙청 명부 is_purged를 만들고, 이후 배열 압축(compress_arr)에 사용됨 */
-    int *is_purged = (int *)calloc(num_of_elements, sizeof(int));
+    int *is_purged = (int *)sort_calloc(num_of_elements, sizeof(int));
     if (SORT_UNLIKELY(is_purged == NULL))
     {
         free(gulag->location);
@@ -40,9 +45,9 @@ Gulag *stalin_sort(void *arr, size_t num_of_elements, size_t size_of_element, in
     for (size_t i = 1; i < num_of_elements; i++)
     {
         void *current = (char *)arr + (i * size_of_element);
-        if (purge_func_ptr(max_element, current) > 0) // 비교 대상 원소가 기준 원소보다 작으면
+        if (sort_compare(purge_func_ptr, max_element, current) > 0) // 비교 대상 원소가 기준 원소보다 작으면
         {
-            memcpy(current_gulag_ptr, current, size_of_element); // 괘씸하므로 숙청
+            sort_memcpy(current_gulag_ptr, current, size_of_element); // 괘씸하므로 숙청
             current_gulag_ptr = (char *)current_gulag_ptr + size_of_element;
             is_purged[i] = 1;
             gulag->count++;
@@ -53,7 +58,7 @@ Gulag *stalin_sort(void *arr, size_t num_of_elements, size_t size_of_element, in
         }
     }
     compress_arr(arr, is_purged, num_of_elements, size_of_element);
-    free(is_purged);
+    sort_free(is_purged);
 
     /* 굴라그에 자리가 남으면 남는 공간을 제거 */
     if (gulag->count > 0)
@@ -84,7 +89,7 @@ static void compress_arr(void *SORT_RESTRICT arr, int *is_purged, size_t num_of_
         {
             if (write_ptr != read_ptr)
             {
-                memcpy(write_ptr, read_ptr, size_of_element);
+                sort_memcpy(write_ptr, read_ptr, size_of_element);
             }
             write_ptr = (char *)write_ptr + size_of_element;
         }
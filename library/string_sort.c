@@ -0,0 +1,503 @@
+/**
+ * @file string_sort.c
+ * @brief 문자열 전용 정렬 구현부 (다중 키 퀵 정렬, LCP 병합 정렬)
+ *
+ * 다중 키 퀵 정렬은 문자열 전체를 비교하는 대신 깊이 depth의 문자 하나로 3-way 분할하고,
+ * 같은 문자 구간만 다음 깊이로 내려가므로 이미 같다고 확인된 공통 접두사를 다시 비교하지 않음
+ * LCP 병합 정렬은 이웃한 문자열의 최장 공통 접두사(LCP) 길이를 함께 병합하여 같은 효과를 얻음
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수 이하의 구간은 depth부터 비교하는 삽입 정렬 */
+#define STRING_INSERTION_LIMIT 16
+/* 이 개수보다 큰 구간은 중앙값 후보 9개(ninther)로 피벗 선택 */
+#define STRING_NINTHER_LIMIT 128
+
+/* LCP 병합 정렬 멀티스레드 인자 전달용 구조체 */
+typedef struct LcpArgStruct
+{
+    char **dest;
+    size_t *dest_lcp;
+    char **src;
+    size_t *src_lcp;
+    size_t left;
+    size_t right;
+    int num_threads;
+} LcpArg;
+
+/* 정렬 설정: 최대 비교 길이와 같은 문자열끼리 원래 순서(주소 순서) 유지 여부 */
+typedef struct StringContextStruct
+{
+    size_t max_length;
+    int is_stable;
+} StringContext;
+
+/* 멀티스레드 인자 전달용 구조체 */
+typedef struct StringArgStruct
+{
+    char **strs;
+    size_t num_of_elements;
+    size_t depth;
+    const StringContext *context;
+    int num_threads;
+} StringArg;
+
+static inline int char_at(const char *str, size_t depth, const StringContext *context);
+static void multikey_quick_sort(char **strs, size_t num_of_elements, size_t depth, const StringContext *context);
+static void parallel_multikey_quick_sort(char **strs, size_t num_of_elements, size_t depth, const StringContext *context, int num_threads);
+static SORT_THREAD_PROC parallel_string_sort(void *arg);
+static size_t partition_by_char(char **strs, size_t num_of_elements, size_t depth, const StringContext *context, size_t *equal_begin, int *pivot_char);
+static void insertion_sort_strings(char **strs, size_t num_of_elements, size_t depth, const StringContext *context);
+static void sort_by_address(char **strs, size_t num_of_elements);
+static int compare_address(const void *a_ptr, const void *b_ptr);
+static void lcp_sort_into(char **dest, size_t *dest_lcp, char **src, size_t *src_lcp, size_t left, size_t right, int num_threads);
+static SORT_THREAD_PROC parallel_lcp_sort(void *arg);
+static void lcp_insertion_sort(char **strs, size_t *lcp, size_t left, size_t right);
+static void lcp_merge(char **dest, size_t *dest_lcp, char **src, const size_t *src_lcp, size_t left, size_t middle, size_t right);
+
+/* [공개 함수] C 문자열 포인터 배열 정렬 */
+void string_sort(char **strs, size_t num_of_elements)
+{
+    if (SORT_UNLIKELY(strs == NULL || num_of_elements <= 1))
+    {
+        return;
+    }
+    StringContext context = {(size_t)-1, 0};
+    parallel_multikey_quick_sort(strs, num_of_elements, 0, &context, sort_worker_count());
+}
+
+/* [공개 함수] 구조체 안의 고정 크기 문자 배열 기준 정렬 */
+int string_sort_field(void *arr, size_t num_of_elements, size_t size_of_element, size_t offset, size_t width)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements <= 1 || size_of_element == 0))
+    {
+        return 0;
+    }
+
+    char **strs = (char **)sort_malloc(num_of_elements * sizeof(char *));
+    char *tmp_arr = (char *)sort_malloc(num_of_elements * size_of_element);
+    if (SORT_UNLIKELY(strs == NULL || tmp_arr == NULL))
+    {
+        sort_free(strs);
+        sort_free(tmp_arr);
+        return -1;
+    }
+
+    char *field = (char *)arr + offset;
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        strs[i] = field;
+        field += size_of_element;
+    }
+
+    /* 필드 포인터만 정렬한 뒤 원소는 한 번만 이동 */
+    StringContext context = {width, 1};
+    parallel_multikey_quick_sort(strs, num_of_elements, 0, &context, sort_worker_count());
+
+    char *dest = tmp_arr;
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        sort_memcpy(dest, strs[i] - offset, size_of_element);
+        dest += size_of_element;
+    }
+    sort_memcpy(arr, tmp_arr, num_of_elements * size_of_element);
+
+    sort_free(strs);
+    sort_free(tmp_arr);
+    return 0;
+}
+
+/* [공개 함수] LCP 병합 정렬 */
+int merge_sort_strings(char **strs, size_t num_of_elements)
+{
+    if (SORT_UNLIKELY(strs == NULL || num_of_elements <= 1))
+    {
+        return 0;
+    }
+
+    /* 문자열 포인터와 LCP 배열을 모두 두 벌씩 두고 병합 방향을 번갈아 사용 */
+    char **tmp_strs = (char **)sort_malloc(num_of_elements * sizeof(char *));
+    size_t *lcp = (size_t *)sort_malloc(num_of_elements * sizeof(size_t));
+    size_t *tmp_lcp = (size_t *)sort_malloc(num_of_elements * sizeof(size_t));
+    if (SORT_UNLIKELY(tmp_strs == NULL || lcp == NULL || tmp_lcp == NULL))
+    {
+        sort_free(tmp_strs);
+        sort_free(lcp);
+        sort_free(tmp_lcp);
+        return -1;
+    }
+    sort_memcpy(tmp_strs, strs, num_of_elements * sizeof(char *));
+
+    lcp_sort_into(strs, lcp, tmp_strs, tmp_lcp, 0, num_of_elements - 1, sort_worker_count());
+
+    sort_free(tmp_strs);
+    sort_free(lcp);
+    sort_free(tmp_lcp);
+    return 0;
+}
+
+/* 깊이 depth의 문자, 문자열 끝이나 최대 길이를 넘으면 0 */
+static inline int char_at(const char *str, size_t depth, const StringContext *context)
+{
+    return (depth < context->max_length) ? (unsigned char)str[depth] : 0;
+}
+
+/*
+ * 다중 키 퀵 정렬, 작은/같은/큰 세 구간 중 가장 큰 구간만 반복문으로 이어서 처리하고 나머지 두 구간은 재귀
+ * 재귀하는 구간은 항상 절반 이하이므로 키가 길거나 공통 접두사가 길어도 재귀 깊이는 log2(n) 이하
+ */
+static void multikey_quick_sort(char **strs, size_t num_of_elements, size_t depth, const StringContext *context)
+{
+    while (num_of_elements > STRING_INSERTION_LIMIT)
+    {
+        size_t equal_begin;
+        int pivot_char;
+        size_t greater_begin = partition_by_char(strs, num_of_elements, depth, context, &equal_begin, &pivot_char);
+
+        char **equal_strs = strs + equal_begin;
+        char **greater_strs = strs + greater_begin;
+        size_t num_less = equal_begin;
+        size_t num_equal = greater_begin - equal_begin;
+        size_t num_greater = num_of_elements - greater_begin;
+        if (pivot_char == 0)
+        {
+            /* 문자열 끝까지 같은 구간은 더 비교할 문자가 없음 */
+            if (context->is_stable)
+            {
+                sort_by_address(equal_strs, num_equal);
+            }
+            num_equal = 0;
+        }
+
+        if (num_equal >= num_less && num_equal >= num_greater)
+        {
+            multikey_quick_sort(strs, num_less, depth, context);
+            multikey_quick_sort(greater_strs, num_greater, depth, context);
+            strs = equal_strs;
+            num_of_elements = num_equal;
+            depth++;
+        }
+        else if (num_less >= num_greater)
+        {
+            multikey_quick_sort(equal_strs, num_equal, depth + 1, context);
+            multikey_quick_sort(greater_strs, num_greater, depth, context);
+            num_of_elements = num_less;
+        }
+        else
+        {
+            multikey_quick_sort(strs, num_less, depth, context);
+            multikey_quick_sort(equal_strs, num_equal, depth + 1, context);
+            strs = greater_strs;
+            num_of_elements = num_greater;
+        }
+    }
+    insertion_sort_strings(strs, num_of_elements, depth, context);
+}
+
+/* 큰 구간은 작은 문자 구간을 다른 스레드에 맡기고 나머지를 현재 스레드에서 처리 */
+static void parallel_multikey_quick_sort(char **strs, size_t num_of_elements, size_t depth, const StringContext *context, int num_threads)
+{
+    if (num_threads <= 1 || num_of_elements < SORT_PARALLEL_THRESHOLD)
+    {
+        multikey_quick_sort(strs, num_of_elements, depth, context);
+        return;
+    }
+
+    size_t equal_begin;
+    int pivot_char;
+    size_t greater_begin = partition_by_char(strs, num_of_elements, depth, context, &equal_begin, &pivot_char);
+
+    /* 구간 크기에 비례하여 스레드 분배 */
+    int less_threads = (int)((double)num_threads * equal_begin / num_of_elements + 0.5);
+    if (less_threads < 1)
+    {
+        less_threads = 1;
+    }
+    int rest_threads = (num_threads - less_threads < 1) ? 1 : num_threads - less_threads;
+
+    StringArg less_arg = {strs, equal_begin, depth, context, less_threads};
+    SortThread thread;
+    int is_spawned = (equal_begin > 0 && sort_thread_create(&thread, parallel_string_sort, &less_arg) == 0);
+    if (SORT_UNLIKELY(!is_spawned))
+    {
+        parallel_string_sort(&less_arg);
+    }
+
+    parallel_multikey_quick_sort(strs + greater_begin, num_of_elements - greater_begin, depth, context, rest_threads);
+    if (pivot_char != 0)
+    {
+        parallel_multikey_quick_sort(strs + equal_begin, greater_begin - equal_begin, depth + 1, context, rest_threads);
+    }
+    else if (context->is_stable)
+    {
+        sort_by_address(strs + equal_begin, greater_begin - equal_begin);
+    }
+
+    if (SORT_LIKELY(is_spawned))
+    {
+        sort_thread_join(thread);
+    }
+}
+
+static SORT_THREAD_PROC parallel_string_sort(void *arg)
+{
+    StringArg *arg_ptr = (StringArg *)arg;
+    parallel_multikey_quick_sort(arg_ptr->strs, arg_ptr->num_of_elements, arg_ptr->depth, arg_ptr->context, arg_ptr->num_threads);
+    return 0;
+}
+
+/**
+ * 깊이 depth의 문자로 3-way 분할하여 [작음 | 같음 | 큼] 순서로 배치
+ * 같음 구간의 시작을 equal_begin에, 피벗 문자를 pivot_char에 기록하고 큼 구간의 시작을 반환
+ */
+static size_t partition_by_char(char **strs, size_t num_of_elements, size_t depth, const StringContext *context, size_t *equal_begin, int *pivot_char)
+{
+    /* 중앙값 피벗 선택 (큰 구간은 ninther) */
+    size_t candidates[9];
+    size_t num_candidates = (num_of_elements > STRING_NINTHER_LIMIT) ? 9 : 3;
+    for (size_t i = 0; i < num_candidates; i++)
+    {
+        candidates[i] = (num_of_elements - 1) * i / (num_candidates - 1);
+    }
+    int values[9];
+    for (size_t i = 0; i < num_candidates; i++)
+    {
+        values[i] = char_at(strs[candidates[i]], depth, context);
+    }
+    for (size_t group = 0; group < num_candidates; group += 3)
+    {
+        int *v = values + group;
+        int median = (v[0] < v[1]) ? ((v[1] < v[2]) ? v[1] : ((v[0] < v[2]) ? v[2] : v[0])) : ((v[0] < v[2]) ? v[0] : ((v[1] < v[2]) ? v[2] : v[1]));
+        values[group / 3] = median;
+    }
+    int pivot = values[0];
+    if (num_candidates == 9)
+    {
+        int *v = values;
+        pivot = (v[0] < v[1]) ? ((v[1] < v[2]) ? v[1] : ((v[0] < v[2]) ? v[2] : v[0])) : ((v[0] < v[2]) ? v[0] : ((v[1] < v[2]) ? v[2] : v[1]));
+    }
+
+    /* Dijkstra 3-way 분할: [0, lt) 작음, [lt, i) 같음, [gt, n) 큼 */
+    size_t lt = 0;
+    size_t i = 0;
+    size_t gt = num_of_elements;
+    while (i < gt)
+    {
+        int c = char_at(strs[i], depth, context);
+        if (c < pivot)
+        {
+            char *swap = strs[lt];
+            strs[lt++] = strs[i];
+            strs[i++] = swap;
+        }
+        else if (c > pivot)
+        {
+            char *swap = strs[--gt];
+            strs[gt] = strs[i];
+            strs[i] = swap;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    *equal_begin = lt;
+    *pivot_char = pivot;
+    return gt;
+}
+
+/* depth 이전은 모두 같으므로 depth부터 비교하는 삽입 정렬 */
+static void insertion_sort_strings(char **strs, size_t num_of_elements, size_t depth, const StringContext *context)
+{
+    for (size_t i = 1; i < num_of_elements; i++)
+    {
+        char *current = strs[i];
+        size_t j = i;
+        while (j > 0)
+        {
+            const char *prev = strs[j - 1];
+            size_t d = depth;
+            int a = char_at(prev, d, context);
+            int b = char_at(current, d, context);
+            while (a == b && a != 0)
+            {
+                d++;
+                a = char_at(prev, d, context);
+                b = char_at(current, d, context);
+            }
+            if (a < b || (a == b && (!context->is_stable || (uintptr_t)prev < (uintptr_t)current)))
+            {
+                break;
+            }
+            strs[j] = strs[j - 1];
+            j--;
+        }
+        strs[j] = current;
+    }
+}
+
+/* 내용이 같은 문자열들을 주소(원래 위치) 순서로 정렬 */
+static void sort_by_address(char **strs, size_t num_of_elements)
+{
+    if (num_of_elements <= STRING_INSERTION_LIMIT)
+    {
+        insertion_sort(strs, num_of_elements, sizeof(char *), compare_address);
+    }
+    else if (SORT_UNLIKELY(merge_sort(strs, num_of_elements, sizeof(char *), compare_address) != 0))
+    {
+        /* 메모리가 부족하면 추가 메모리 없이 정렬 */
+        insertion_sort_binary(strs, num_of_elements, sizeof(char *), compare_address);
+    }
+}
+
+static int compare_address(const void *a_ptr, const void *b_ptr)
+{
+    uintptr_t a = (uintptr_t)*(char *const *)a_ptr;
+    uintptr_t b = (uintptr_t)*(char *const *)b_ptr;
+    return (a > b) - (a < b);
+}
+
+/**
+ * [left, right] 구간을 정렬하여 dest에, 이웃한 문자열의 LCP를 dest_lcp에 기록 (dest_lcp[left]는 사용하지 않음)
+ * 호출 시 src와 dest의 해당 구간에는 같은 원소들이 들어 있어야 하며, src는 양쪽 절반을 정렬하는 데 사용됨
+ */
+static void lcp_sort_into(char **dest, size_t *dest_lcp, char **src, size_t *src_lcp, size_t left, size_t right, int num_threads)
+{
+    if (right - left + 1 <= STRING_INSERTION_LIMIT)
+    {
+        lcp_insertion_sort(dest, dest_lcp, left, right);
+        return;
+    }
+
+    size_t middle = left + (right - left) / 2;
+    if (num_threads > 1 && right - left + 1 >= SORT_PARALLEL_THRESHOLD)
+    {
+        LcpArg left_arg = {src, src_lcp, dest, dest_lcp, left, middle, num_threads / 2};
+        SortThread thread;
+        int is_spawned = (sort_thread_create(&thread, parallel_lcp_sort, &left_arg) == 0);
+        if (SORT_UNLIKELY(!is_spawned))
+        {
+            left_arg.num_threads = 1;
+            parallel_lcp_sort(&left_arg);
+        }
+        lcp_sort_into(src, src_lcp, dest, dest_lcp, middle + 1, right, num_threads - num_threads / 2);
+        if (SORT_LIKELY(is_spawned))
+        {
+            sort_thread_join(thread);
+        }
+    }
+    else
+    {
+        lcp_sort_into(src, src_lcp, dest, dest_lcp, left, middle, 1);
+        lcp_sort_into(src, src_lcp, dest, dest_lcp, middle + 1, right, 1);
+    }
+    lcp_merge(dest, dest_lcp, src, src_lcp, left, middle, right);
+}
+
+static SORT_THREAD_PROC parallel_lcp_sort(void *arg)
+{
+    LcpArg *arg_ptr = (LcpArg *)arg;
+    lcp_sort_into(arg_ptr->dest, arg_ptr->dest_lcp, arg_ptr->src, arg_ptr->src_lcp, arg_ptr->left, arg_ptr->right, arg_ptr->num_threads);
+    return 0;
+}
+
+/* 작은 구간의 안정 삽입 정렬 후 이웃한 문자열의 LCP 계산 */
+static void lcp_insertion_sort(char **strs, size_t *lcp, size_t left, size_t right)
+{
+    for (size_t i = left + 1; i <= right; i++)
+    {
+        char *current = strs[i];
+        size_t j = i;
+        while (j > left && strcmp(strs[j - 1], current) > 0)
+        {
+            strs[j] = strs[j - 1];
+            j--;
+        }
+        strs[j] = current;
+    }
+    for (size_t i = left + 1; i <= right; i++)
+    {
+        const char *a = strs[i - 1];
+        const char *b = strs[i];
+        size_t d = 0;
+        while (a[d] == b[d] && a[d] != '\0')
+        {
+            d++;
+        }
+        lcp[i] = d;
+    }
+}
+
+/**
+ * src의 정렬된 두 구간 [left, middle], [middle + 1, right]를 dest로 병합 (안정 병합)
+ * left_lcp, right_lcp는 각 구간의 현재 원소와 마지막으로 출력한 원소의 LCP로,
+ * 두 값이 다르면 문자를 비교하지 않고 LCP가 큰 쪽이 작은 문자열이며 같을 때만 그 길이 이후부터 비교
+ */
+static void lcp_merge(char **dest, size_t *dest_lcp, char **src, const size_t *src_lcp, size_t left, size_t middle, size_t right)
+{
+    size_t i = left;
+    size_t j = middle + 1;
+    size_t k = left;
+    size_t left_lcp = 0;
+    size_t right_lcp = 0;
+
+    while (i <= middle && j <= right)
+    {
+        if (left_lcp > right_lcp)
+        {
+            dest_lcp[k] = left_lcp;
+            dest[k++] = src[i++];
+            left_lcp = src_lcp[i]; // i가 middle을 넘으면 반복문이 끝나므로 사용되지 않음
+        }
+        else if (left_lcp < right_lcp)
+        {
+            dest_lcp[k] = right_lcp;
+            dest[k++] = src[j++];
+            right_lcp = (j <= right) ? src_lcp[j] : 0;
+        }
+        else
+        {
+            const unsigned char *a = (const unsigned char *)src[i];
+            const unsigned char *b = (const unsigned char *)src[j];
+            size_t d = left_lcp;
+            while (a[d] == b[d] && a[d] != '\0')
+            {
+                d++;
+            }
+            dest_lcp[k] = left_lcp;
+            if (a[d] <= b[d])
+            {
+                dest[k++] = src[i++];
+                right_lcp = d;
+                left_lcp = src_lcp[i];
+            }
+            else
+            {
+                dest[k++] = src[j++];
+                left_lcp = d;
+                right_lcp = (j <= right) ? src_lcp[j] : 0;
+            }
+        }
+    }
+
+    /* 남은 구간의 첫 원소는 현재 LCP를, 나머지는 기존 LCP를 그대로 사용 */
+    if (i <= middle)
+    {
+        dest_lcp[k] = left_lcp;
+        dest[k++] = src[i++];
+        sort_memcpy(&dest[k], &src[i], (middle - i + 1) * sizeof(char *));
+        sort_memcpy(&dest_lcp[k], &src_lcp[i], (middle - i + 1) * sizeof(size_t));
+    }
+    else if (j <= right)
+    {
+        dest_lcp[k] = right_lcp;
+        dest[k++] = src[j++];
+        sort_memcpy(&dest[k], &src[j], (right - j + 1) * sizeof(char *));
+        sort_memcpy(&dest_lcp[k], &src_lcp[j], (right - j + 1) * sizeof(size_t));
+    }
+}
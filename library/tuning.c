@@ -0,0 +1,464 @@
+/**
+ * @file tuning.c
+ * @brief 병렬화 기준, 삽입 정렬 전환 기준, 스레드 수 등 튜닝 값의 관리와 보정 실행 구현부
+ *
+ * 튜닝 값은 처음 사용될 때 환경 변수 SORT_TUNING_FILE이 가리키는 설정 파일에서 한 번 읽고, 이후에는 sort_set_tuning으로만 바뀜
+ * 작업 디렉터리에 우연히 있는 파일로 동작이 바뀌지 않도록 기본 경로는 없음 (빌드 시 SORT_TUNING_DEFAULT_PATH로 지정 가능)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+#define DEFAULT_PARALLEL_THRESHOLD 16384
+#define DEFAULT_INSERTION_CUTOFF 16
+#define DEFAULT_WIDE_ELEMENT 64
+#define DEFAULT_AUTO_INSERTION_LIMIT 32
+#define DEFAULT_AUTO_FEW_UNIQUE_PERMILLE 125
+
+/* 보정 실행에서 사용할 최대 원소 수와 후보마다 반복 측정할 횟수 */
+#define CALIBRATE_ELEMENTS ((size_t)1 << 21)
+#define CALIBRATE_TRIALS 3
+
+/* 설정 파일을 읽기 전에도 유효한 값이 보이도록 기본값으로 초기화 */
+static SortTuning current_tuning = {DEFAULT_PARALLEL_THRESHOLD, DEFAULT_INSERTION_CUTOFF, 0, DEFAULT_WIDE_ELEMENT, DEFAULT_AUTO_INSERTION_LIMIT, DEFAULT_AUTO_FEW_UNIQUE_PERMILLE};
+static volatile size_t is_tuning_loaded = 0; // 1을 release로 기록하여, 1을 본 스레드는 current_tuning도 완성된 값을 봄
+static SortMutex tuning_mutex = SORT_MUTEX_INIT;
+
+typedef int (*SortFunc)(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+
+static void set_default_tuning(SortTuning *tuning);
+static void normalize_tuning(SortTuning *tuning);
+static int compare_int_key(const void *a_ptr, const void *b_ptr);
+static void fill_random_keys(char *arr, size_t num_of_elements, size_t size_of_element, size_t num_distinct);
+static int insertion_sort_func(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr));
+static double time_sort(SortFunc sort_func_ptr, char *work, const char *source, size_t num_of_elements, size_t size_of_element);
+static double time_sort_chunks(SortFunc sort_func_ptr, char *work, const char *source, size_t num_of_elements, size_t size_of_element, size_t chunk);
+
+/* 현재 적용 중인 튜닝 값, 처음 호출될 때 설정 파일(있으면)을 읽음 */
+const SortTuning *sort_tuning_current(void)
+{
+    if (SORT_LIKELY(sort_atomic_load_acquire(&is_tuning_loaded)))
+    {
+        return &current_tuning;
+    }
+    sort_mutex_lock(&tuning_mutex);
+    if (!sort_atomic_load_acquire(&is_tuning_loaded))
+    {
+        const char *path = getenv("SORT_TUNING_FILE");
+#if defined(SORT_TUNING_DEFAULT_PATH)
+        if (path == NULL || path[0] == '\0')
+        {
+            path = SORT_TUNING_DEFAULT_PATH;
+        }
+#endif
+        SortTuning loaded;
+        if (path != NULL && path[0] != '\0' && sort_tuning_load(path, &loaded) == 0)
+        {
+            current_tuning = loaded;
+        }
+        sort_atomic_store_release(&is_tuning_loaded, 1);
+    }
+    sort_mutex_unlock(&tuning_mutex);
+    return &current_tuning;
+}
+
+/* [공개 함수] 현재 튜닝 값 복사 */
+void sort_get_tuning(SortTuning *out)
+{
+    if (SORT_UNLIKELY(out == NULL))
+    {
+        return;
+    }
+    *out = *sort_tuning_current();
+}
+
+/* [공개 함수] 튜닝 값 변경 */
+void sort_set_tuning(const SortTuning *tuning)
+{
+    SortTuning new_tuning;
+    if (tuning == NULL)
+    {
+        set_default_tuning(&new_tuning);
+    }
+    else
+    {
+        new_tuning = *tuning;
+        normalize_tuning(&new_tuning);
+    }
+    sort_mutex_lock(&tuning_mutex);
+    current_tuning = new_tuning;
+    sort_atomic_store_release(&is_tuning_loaded, 1); // 명시적으로 설정한 값을 나중에 설정 파일이 덮어쓰지 않도록 함
+    sort_mutex_unlock(&tuning_mutex);
+}
+
+/* [공개 함수] 작업 스레드 수 고정 */
+void sort_set_thread_count(int num_threads)
+{
+    sort_tuning_current(); // 설정 파일을 먼저 읽어 다른 값은 유지
+    sort_mutex_lock(&tuning_mutex);
+    current_tuning.num_threads = (num_threads > 0) ? num_threads : 0;
+    sort_mutex_unlock(&tuning_mutex);
+}
+
+/* [공개 함수] 병렬 정렬이 사용할 작업 스레드 수 */
+int sort_get_thread_count(void)
+{
+    return sort_worker_count();
+}
+
+/* [공개 함수] 튜닝 값 저장 */
+int sort_tuning_save(const char *path, const SortTuning *tuning)
+{
+    if (SORT_UNLIKELY(path == NULL || tuning == NULL))
+    {
+        return -1;
+    }
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    fprintf(file, "# sort tuning\n");
+    fprintf(file, "parallel_threshold = %llu\n", (unsigned long long)tuning->parallel_threshold);
+    fprintf(file, "insertion_cutoff = %llu\n", (unsigned long long)tuning->insertion_cutoff);
+    fprintf(file, "num_threads = %d\n", tuning->num_threads);
+    fprintf(file, "wide_element = %llu\n", (unsigned long long)tuning->wide_element);
+    fprintf(file, "auto_insertion_limit = %llu\n", (unsigned long long)tuning->auto_insertion_limit);
+    fprintf(file, "auto_few_unique_permille = %llu\n", (unsigned long long)tuning->auto_few_unique_permille);
+    int is_failed = ferror(file);
+    if (fclose(file) != 0)
+    {
+        is_failed = 1;
+    }
+    return is_failed ? -1 : 0;
+}
+
+/* [공개 함수] 튜닝 값 읽기 */
+int sort_tuning_load(const char *path, SortTuning *out)
+{
+    if (SORT_UNLIKELY(path == NULL || out == NULL))
+    {
+        return -1;
+    }
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        return -1;
+    }
+    set_default_tuning(out);
+
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *name = line;
+        while (*name == ' ' || *name == '\t')
+        {
+            name++;
+        }
+        char *separator = strchr(name, '=');
+        if (*name == '#' || separator == NULL)
+        {
+            continue;
+        }
+        /* 이름 뒤의 공백 제거 */
+        char *name_end = separator;
+        while (name_end > name && (name_end[-1] == ' ' || name_end[-1] == '\t'))
+        {
+            name_end--;
+        }
+        *name_end = '\0';
+        unsigned long long value = strtoull(separator + 1, NULL, 10);
+
+        if (strcmp(name, "parallel_threshold") == 0)
+        {
+            out->parallel_threshold = (size_t)value;
+        }
+        else if (strcmp(name, "insertion_cutoff") == 0)
+        {
+            out->insertion_cutoff = (size_t)value;
+        }
+        else if (strcmp(name, "num_threads") == 0)
+        {
+            out->num_threads = (int)value;
+        }
+        else if (strcmp(name, "wide_element") == 0)
+        {
+            out->wide_element = (size_t)value;
+        }
+        else if (strcmp(name, "auto_insertion_limit") == 0)
+        {
+            out->auto_insertion_limit = (size_t)value;
+        }
+        else if (strcmp(name, "auto_few_unique_permille") == 0)
+        {
+            out->auto_few_unique_permille = (size_t)value;
+        }
+    }
+    fclose(file);
+    normalize_tuning(out);
+    return 0;
+}
+
+/* [공개 함수] 보정 실행 */
+int sort_calibrate(SortTuning *out)
+{
+    if (SORT_UNLIKELY(out == NULL))
+    {
+        return -1;
+    }
+    /* 가장 큰 측정(2^21개의 int, 같은 바이트 수의 넓은 원소)에 맞춘 원본과 작업용 배열 */
+    size_t buffer_bytes = CALIBRATE_ELEMENTS * sizeof(int);
+    char *source = (char *)malloc(buffer_bytes);
+    char *work = (char *)malloc(buffer_bytes);
+    if (SORT_UNLIKELY(source == NULL || work == NULL))
+    {
+        free(source);
+        free(work);
+        return -1;
+    }
+
+    SortTuning previous;
+    sort_get_tuning(&previous);
+    SortTuning trial;
+    set_default_tuning(&trial);
+    int is_failed = 0;
+
+    /* 1. 삽입 정렬 전환 기준: 싱글 스레드 병합 정렬로 측정 */
+    static const size_t cutoff_candidates[] = {1, 8, 12, 16, 24, 32, 48, 64};
+    size_t num_of_elements = CALIBRATE_ELEMENTS / 8;
+    fill_random_keys(source, num_of_elements, sizeof(int), 0);
+    double best_time = -1.0;
+    for (size_t i = 0; i < sizeof(cutoff_candidates) / sizeof(cutoff_candidates[0]) && !is_failed; i++)
+    {
+        trial.insertion_cutoff = cutoff_candidates[i];
+        sort_set_tuning(&trial);
+        double elapsed = time_sort(merge_sort, work, source, num_of_elements, sizeof(int));
+        is_failed = (elapsed < 0.0);
+        if (!is_failed && (best_time < 0.0 || elapsed < best_time))
+        {
+            best_time = elapsed;
+            out->insertion_cutoff = cutoff_candidates[i];
+        }
+    }
+    trial.insertion_cutoff = out->insertion_cutoff;
+
+    /* 2. 스레드 수: 1, 2, 4, ...와 코어 수 중 가장 빠른 값 */
+    num_of_elements = CALIBRATE_ELEMENTS;
+    fill_random_keys(source, num_of_elements, sizeof(int), 0);
+    int cpu_count = sort_cpu_count();
+    best_time = -1.0;
+    out->num_threads = 1;
+    for (int num_threads = 1; !is_failed; num_threads = (num_threads * 2 < cpu_count) ? num_threads * 2 : cpu_count)
+    {
+        trial.num_threads = num_threads;
+        sort_set_tuning(&trial);
+        double elapsed = time_sort(merge_sort_multi, work, source, num_of_elements, sizeof(int));
+        is_failed = (elapsed < 0.0);
+        if (!is_failed && (best_time < 0.0 || elapsed < best_time))
+        {
+            best_time = elapsed;
+            out->num_threads = num_threads;
+        }
+        if (num_threads >= cpu_count)
+        {
+            break;
+        }
+    }
+    trial.num_threads = out->num_threads;
+
+    /* 3. 병렬화 기준: 스레드를 더 나누는 것보다 싱글 스레드로 정렬하는 편이 빠른 구간 크기 */
+    static const size_t threshold_candidates[] = {4096, 8192, 16384, 32768, 65536, 131072};
+    num_of_elements = CALIBRATE_ELEMENTS / 2;
+    best_time = -1.0;
+    out->parallel_threshold = DEFAULT_PARALLEL_THRESHOLD;
+    for (size_t i = 0; i < sizeof(threshold_candidates) / sizeof(threshold_candidates[0]) && !is_failed && trial.num_threads > 1; i++)
+    {
+        trial.parallel_threshold = threshold_candidates[i];
+        sort_set_tuning(&trial);
+        double elapsed = time_sort(merge_sort_multi, work, source, num_of_elements, sizeof(int));
+        is_failed = (elapsed < 0.0);
+        if (!is_failed && (best_time < 0.0 || elapsed < best_time))
+        {
+            best_time = elapsed;
+            out->parallel_threshold = threshold_candidates[i];
+        }
+    }
+    trial.parallel_threshold = out->parallel_threshold;
+
+    /* 4. 넓은 원소 기준: 같은 바이트 수에서 merge_sort_pp가 merge_sort_multi보다 처음 빨라지는 원소 크기의 직전 크기 */
+    out->wide_element = 256;
+    sort_set_tuning(&trial);
+    for (size_t size_of_element = 16; size_of_element <= 256 && !is_failed; size_of_element *= 2)
+    {
+        num_of_elements = buffer_bytes / size_of_element;
+        fill_random_keys(source, num_of_elements, size_of_element, 0);
+        double multi_time = time_sort(merge_sort_multi, work, source, num_of_elements, size_of_element);
+        double pp_time = time_sort(merge_sort_pp, work, source, num_of_elements, size_of_element);
+        is_failed = (multi_time < 0.0 || pp_time < 0.0);
+        if (!is_failed && pp_time < multi_time)
+        {
+            out->wide_element = size_of_element / 2;
+            break;
+        }
+    }
+    trial.wide_element = out->wide_element;
+
+    /* 5. 자동 정렬의 삽입 정렬 기준: 작은 배열 여러 개를 정렬할 때 이진 삽입 정렬이 병합 정렬보다 빠른 가장 큰 크기 */
+    static const size_t small_candidates[] = {8, 16, 24, 32, 48, 64, 96, 128};
+    num_of_elements = CALIBRATE_ELEMENTS / 16;
+    fill_random_keys(source, num_of_elements, sizeof(int), 0);
+    out->auto_insertion_limit = small_candidates[0];
+    sort_set_tuning(&trial);
+    for (size_t i = 0; i < sizeof(small_candidates) / sizeof(small_candidates[0]) && !is_failed; i++)
+    {
+        double insertion_time = time_sort_chunks(insertion_sort_func, work, source, num_of_elements, sizeof(int), small_candidates[i]);
+        double merge_time = time_sort_chunks(merge_sort, work, source, num_of_elements, sizeof(int), small_candidates[i]);
+        is_failed = (insertion_time < 0.0 || merge_time < 0.0);
+        if (!is_failed && insertion_time <= merge_time)
+        {
+            out->auto_insertion_limit = small_candidates[i];
+        }
+    }
+
+    /*
+     * 6. 자동 정렬의 중복 기준: 서로 다른 키가 d개인 입력에서 sort_few_unique가 merge_sort_multi보다 빠른 가장 큰 d를 찾고,
+     *    auto_sort가 표본 SORT_AUTO_PROBE_SAMPLES개에서 보게 될 서로 다른 값의 비율 d * (1 - (1 - 1/d)^표본 수) / 표본 수로 바꿈
+     */
+    static const size_t distinct_candidates[] = {2, 8, 32, 64, 128, 256, 1024};
+    num_of_elements = CALIBRATE_ELEMENTS / 4;
+    out->auto_few_unique_permille = 1; // 한 번도 빠르지 않으면 사용하지 않음
+    for (size_t i = 0; i < sizeof(distinct_candidates) / sizeof(distinct_candidates[0]) && !is_failed; i++)
+    {
+        size_t num_distinct = distinct_candidates[i];
+        fill_random_keys(source, num_of_elements, sizeof(int), num_distinct);
+        double few_unique_time = time_sort(sort_few_unique, work, source, num_of_elements, sizeof(int));
+        double multi_time = time_sort(merge_sort_multi, work, source, num_of_elements, sizeof(int));
+        is_failed = (few_unique_time < 0.0 || multi_time < 0.0);
+        if (is_failed || few_unique_time >= multi_time)
+        {
+            break;
+        }
+        double missed = 1.0;
+        for (int s = 0; s < SORT_AUTO_PROBE_SAMPLES; s++)
+        {
+            missed *= 1.0 - 1.0 / (double)num_distinct;
+        }
+        double permille = 1000.0 * (double)num_distinct * (1.0 - missed) / SORT_AUTO_PROBE_SAMPLES;
+        out->auto_few_unique_permille = (permille < 1000.0) ? (size_t)(permille + 0.5) : 1000;
+    }
+
+    sort_set_tuning(&previous);
+    free(source);
+    free(work);
+    return is_failed ? -1 : 0;
+}
+
+static void set_default_tuning(SortTuning *tuning)
+{
+    tuning->parallel_threshold = DEFAULT_PARALLEL_THRESHOLD;
+    tuning->insertion_cutoff = DEFAULT_INSERTION_CUTOFF;
+    tuning->num_threads = 0;
+    tuning->wide_element = DEFAULT_WIDE_ELEMENT;
+    tuning->auto_insertion_limit = DEFAULT_AUTO_INSERTION_LIMIT;
+    tuning->auto_few_unique_permille = DEFAULT_AUTO_FEW_UNIQUE_PERMILLE;
+}
+
+/* 0이나 범위를 벗어난 값은 기본값으로 바꿈 */
+static void normalize_tuning(SortTuning *tuning)
+{
+    if (tuning->parallel_threshold == 0)
+    {
+        tuning->parallel_threshold = DEFAULT_PARALLEL_THRESHOLD;
+    }
+    if (tuning->insertion_cutoff == 0)
+    {
+        tuning->insertion_cutoff = DEFAULT_INSERTION_CUTOFF;
+    }
+    if (tuning->num_threads < 0)
+    {
+        tuning->num_threads = 0;
+    }
+    if (tuning->wide_element == 0)
+    {
+        tuning->wide_element = DEFAULT_WIDE_ELEMENT;
+    }
+    if (tuning->auto_insertion_limit == 0)
+    {
+        tuning->auto_insertion_limit = DEFAULT_AUTO_INSERTION_LIMIT;
+    }
+    if (tuning->auto_few_unique_permille == 0)
+    {
+        tuning->auto_few_unique_permille = DEFAULT_AUTO_FEW_UNIQUE_PERMILLE;
+    }
+    else if (tuning->auto_few_unique_permille > 1000)
+    {
+        tuning->auto_few_unique_permille = 1000;
+    }
+}
+
+/* 원소의 첫 int를 키로 비교 */
+static int compare_int_key(const void *a_ptr, const void *b_ptr)
+{
+    int a_key;
+    int b_key;
+    memcpy(&a_key, a_ptr, sizeof(int));
+    memcpy(&b_key, b_ptr, sizeof(int));
+    return (a_key > b_key) - (a_key < b_key);
+}
+
+/* 고정 시드 난수 키로 원소를 채움 (원소의 나머지 바이트는 0), num_distinct가 0이 아니면 키를 그 개수의 값으로 제한 */
+static void fill_random_keys(char *arr, size_t num_of_elements, size_t size_of_element, size_t num_distinct)
+{
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    memset(arr, 0, num_of_elements * size_of_element);
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        int key = (num_distinct != 0) ? (int)((state >> 32) % num_distinct) : (int)(uint32_t)(state >> 32);
+        memcpy(arr + i * size_of_element, &key, sizeof(int));
+    }
+}
+
+/* SortFunc 형태의 이진 삽입 정렬 */
+static int insertion_sort_func(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    insertion_sort_binary(arr, num_of_elements, size_of_element, cmp_func_ptr);
+    return 0;
+}
+
+/* 원본을 복사하여 정렬하기를 CALIBRATE_TRIALS회 반복한 최소 시간(초), 정렬에 실패하면 -1.0 */
+static double time_sort(SortFunc sort_func_ptr, char *work, const char *source, size_t num_of_elements, size_t size_of_element)
+{
+    return time_sort_chunks(sort_func_ptr, work, source, num_of_elements, size_of_element, num_of_elements);
+}
+
+/* time_sort와 같지만 배열을 chunk개씩 나눠 각각 정렬 */
+static double time_sort_chunks(SortFunc sort_func_ptr, char *work, const char *source, size_t num_of_elements, size_t size_of_element, size_t chunk)
+{
+    double best_time = -1.0;
+    for (int trial = 0; trial < CALIBRATE_TRIALS; trial++)
+    {
+        memcpy(work, source, num_of_elements * size_of_element);
+        double start = sort_now_seconds();
+        for (size_t begin = 0; begin < num_of_elements; begin += chunk)
+        {
+            size_t count = (num_of_elements - begin < chunk) ? num_of_elements - begin : chunk;
+            if (sort_func_ptr(work + begin * size_of_element, count, size_of_element, compare_int_key) != 0)
+            {
+                return -1.0;
+            }
+        }
+        double elapsed = sort_now_seconds() - start;
+        if (best_time < 0.0 || elapsed < best_time)
+        {
+            best_time = elapsed;
+        }
+    }
+    return best_time;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file unique_sort.c
+ * @brief 정렬 후 같은 원소를 묶거나 제거하는 정렬 구현부 (sort_and_count, sort_unique)
+ *
+ * sort_unique는 병합 정렬의 모든 단계에서 같은 원소를 제거하므로, 중복이 많을수록 위 단계의 병합 대상이 줄어듦
+ * 구간 [begin, begin + count)를 정렬하면 앞쪽 num_unique개는 정렬된 서로 다른 원소, 뒤쪽은 제거된 원소가 됨
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 이 개수 이하의 구간은 이진 삽입 정렬 후 중복 제거 */
+#define UNIQUE_INSERTION_LIMIT 16
+
+/* 멀티스레드 인자 전달용 구조체, 구간 [begin, begin + count)를 담당 */
+typedef struct UniqueArgStruct
+{
+    char *arr;
+    char *tmp_arr;
+    size_t size_of_element;
+    CmpFunc cmp_func_ptr;
+    int keep_removed;       // 0이면 제거된 원소를 보존하지 않음 (뒤쪽 내용이 정의되지 않음)
+    size_t begin;
+    size_t count;
+    size_t num_unique;
+    size_t right_count;     // 병합 단계에서 바로 뒤에 붙은 구간의 크기
+    size_t right_unique;
+} UniqueArg;
+
+static int unique_sort(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t *out_num_of_elements);
+static size_t unique_sort_range(char *arr, char *tmp_arr, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t begin, size_t count);
+static size_t unique_merge(char *arr, char *tmp_arr, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t begin, size_t left_count, size_t left_unique, size_t right_count, size_t right_unique);
+static SORT_THREAD_PROC unique_sort_chunk(void *arg);
+static SORT_THREAD_PROC unique_merge_pair(void *arg);
+
+/* [공개 함수] 정렬 후 같은 원소를 하나로 합치고 개수를 기록 */
+int sort_and_count(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *counts, size_t *out_num_of_elements)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements == 0 || size_of_element == 0))
+    {
+        if (out_num_of_elements != NULL)
+        {
+            *out_num_of_elements = 0;
+        }
+        return 0;
+    }
+    if (SORT_UNLIKELY(sort_few_unique(arr, num_of_elements, size_of_element, cmp_func_ptr) != 0))
+    {
+        return -1;
+    }
+
+    /* 같은 값 구간마다 첫 원소만 앞으로 당기고 구간 길이를 기록 */
+    char *base = (char *)arr;
+    size_t num_unique = 0;
+    size_t run_start = 0;
+    for (size_t i = 1; i <= num_of_elements; i++)
+    {
+        if (i < num_of_elements && sort_compare(cmp_func_ptr, base + run_start * size_of_element, base + i * size_of_element) == 0)
+        {
+            continue;
+        }
+        if (num_unique != run_start)
+        {
+            sort_memcpy(base + num_unique * size_of_element, base + run_start * size_of_element, size_of_element);
+        }
+        if (counts != NULL)
+        {
+            counts[num_unique] = i - run_start;
+        }
+        num_unique++;
+        run_start = i;
+    }
+
+    if (out_num_of_elements != NULL)
+    {
+        *out_num_of_elements = num_unique;
+    }
+    return 0;
+}
+
+/* [공개 함수] 정렬하면서 같은 원소 제거 */
+int sort_unique(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *out_num_of_elements)
+{
+    return unique_sort(arr, num_of_elements, size_of_element, cmp_func_ptr, 0, out_num_of_elements);
+}
+
+/* [공개 함수] 정렬하면서 같은 원소를 제거하고, 제거된 원소는 굴라그로 보냄 */
+Gulag *sort_unique_gulag(void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr), size_t *out_num_of_elements)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements == 0 || size_of_element == 0))
+    {
+        return NULL;
+    }
+    /* 호출자가 free로 해제하므로 교체한 할당 함수(sort_set_allocator)를 거치지 않음 */
+    Gulag *gulag = (Gulag *)calloc(1, sizeof(Gulag));
+    if (SORT_UNLIKELY(gulag == NULL))
+    {
+        return NULL;
+    }
+    gulag->location = malloc(num_of_elements * size_of_element);
+    size_t num_unique = 0;
+    if (SORT_UNLIKELY(gulag->location == NULL || unique_sort(arr, num_of_elements, size_of_element, cmp_func_ptr, 1, &num_unique) != 0))
+    {
+        free(gulag->location);
+        free(gulag);
+        return NULL;
+    }
+
+    /* 배열 뒤쪽에 모인 제거된 원소를 굴라그로 옮기고 남는 공간을 제거 */
+    gulag->count = num_of_elements - num_unique;
+    if (gulag->count > 0)
+    {
+        sort_memcpy(gulag->location, (char *)arr + num_unique * size_of_element, gulag->count * size_of_element);
+        void *shrunk = realloc(gulag->location, gulag->count * size_of_element);
+        if (SORT_LIKELY(shrunk != NULL))
+        {
+            gulag->location = shrunk;
+        }
+    }
+    else
+    {
+        free(gulag->location);
+        gulag->location = NULL;
+    }
+    if (out_num_of_elements != NULL)
+    {
+        *out_num_of_elements = num_unique;
+    }
+    return gulag;
+}
+
+/* 스레드마다 한 구간씩 정렬-중복 제거한 뒤, 이웃한 구간끼리 병합 라운드를 반복 */
+static int unique_sort(void *arr, size_t num_of_elements, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t *out_num_of_elements)
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements == 0 || size_of_element == 0))
+    {
+        if (out_num_of_elements != NULL)
+        {
+            *out_num_of_elements = 0;
+        }
+        return 0;
+    }
+
+    /* 스레드당 최소 SORT_PARALLEL_THRESHOLD개를 맡도록 스레드 수 조절 */
+    int cpu_count = sort_worker_count();
+    int num_workers = (num_of_elements / SORT_PARALLEL_THRESHOLD < (size_t)cpu_count) ? (int)(num_of_elements / SORT_PARALLEL_THRESHOLD) : cpu_count;
+    if (num_workers < 1)
+    {
+        num_workers = 1;
+    }
+
+    char *tmp_arr = (char *)sort_malloc(num_of_elements * size_of_element);
+    UniqueArg *args = (UniqueArg *)sort_malloc(num_workers * sizeof(UniqueArg));
+    if (SORT_UNLIKELY(tmp_arr == NULL || args == NULL))
+    {
+        sort_free(tmp_arr);
+        sort_free(args);
+        return -1;
+    }
+
+    size_t chunk = num_of_elements / num_workers;
+    for (int t = 0; t < num_workers; t++)
+    {
+        size_t begin = t * chunk;
+        size_t end = (t == num_workers - 1) ? num_of_elements : (t + 1) * chunk;
+        UniqueArg unique_arg = {(char *)arr, tmp_arr, size_of_element, cmp_func_ptr, keep_removed, begin, end - begin, 0, 0, 0};
+        args[t] = unique_arg;
+    }
+    sort_run_workers(unique_sort_chunk, args, sizeof(UniqueArg), num_workers);
+
+    /* 병합 라운드: (0, 1), (2, 3), ... 구간 쌍을 병합하여 앞쪽 인자에 결과를 모음 */
+    int num_runs = num_workers;
+    while (num_runs > 1)
+    {
+        int num_pairs = num_runs / 2;
+        for (int p = 0; p < num_pairs; p++)
+        {
+            args[p] = args[2 * p];
+            args[p].right_count = args[2 * p + 1].count;
+            args[p].right_unique = args[2 * p + 1].num_unique;
+        }
+        sort_run_workers(unique_merge_pair, args, sizeof(UniqueArg), num_pairs);
+        if (num_runs % 2 == 1)
+        {
+            args[num_pairs] = args[num_runs - 1];
+        }
+        num_runs = num_pairs + num_runs % 2;
+    }
+
+    if (out_num_of_elements != NULL)
+    {
+        *out_num_of_elements = args[0].num_unique;
+    }
+    sort_free(tmp_arr);
+    sort_free(args);
+    return 0;
+}
+
+/* 구간을 정렬하고 중복을 제거한 뒤 서로 다른 원소의 수를 반환 */
+static size_t unique_sort_range(char *arr, char *tmp_arr, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t begin, size_t count)
+{
+    if (count <= UNIQUE_INSERTION_LIMIT)
+    {
+        char *base = arr + begin * size_of_element;
+        insertion_sort_binary(base, count, size_of_element, cmp_func_ptr);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        /* 같은 값 중 첫 원소만 앞으로 모으고, 보존이 필요하면 제거된 원소는 tmp_arr 뒤쪽부터 모아 뒤에 붙임 */
+        char *removed = tmp_arr + (begin + count) * size_of_element;
+        size_t num_unique = 1;
+        for (size_t i = 1; i < count; i++)
+        {
+            char *current = base + i * size_of_element;
+            if (sort_compare(cmp_func_ptr, base + (num_unique - 1) * size_of_element, current) != 0)
+            {
+                if (num_unique != i)
+                {
+                    sort_memcpy(base + num_unique * size_of_element, current, size_of_element);
+                }
+                num_unique++;
+            }
+            else if (keep_removed)
+            {
+                removed -= size_of_element;
+                sort_memcpy(removed, current, size_of_element);
+            }
+        }
+        if (keep_removed && num_unique < count)
+        {
+            sort_memcpy(base + num_unique * size_of_element, removed, (count - num_unique) * size_of_element);
+        }
+        return num_unique;
+    }
+
+    size_t left_count = count / 2;
+    size_t left_unique = unique_sort_range(arr, tmp_arr, size_of_element, cmp_func_ptr, keep_removed, begin, left_count);
+    size_t right_unique = unique_sort_range(arr, tmp_arr, size_of_element, cmp_func_ptr, keep_removed, begin + left_count, count - left_count);
+    return unique_merge(arr, tmp_arr, size_of_element, cmp_func_ptr, keep_removed, begin, left_count, left_unique, count - left_count, right_unique);
+}
+
+/**
+ * 이웃한 두 구간의 서로 다른 원소들을 병합하며, 양쪽에 같은 원소가 있으면 왼쪽(먼저 나온) 원소만 남김
+ * 결과 구간의 뒤쪽에는 [왼쪽의 제거된 원소 | 오른쪽의 제거된 원소 | 이번에 제거된 원소] 순서로 모음
+ */
+static size_t unique_merge(char *arr, char *tmp_arr, size_t size_of_element, CmpFunc cmp_func_ptr, int keep_removed, size_t begin, size_t left_count, size_t left_unique, size_t right_count, size_t right_unique)
+{
+    char *left = arr + begin * size_of_element;
+    char *left_end = left + left_unique * size_of_element;
+    char *right = left + left_count * size_of_element;
+    char *right_end = right + right_unique * size_of_element;
+    char *dest = tmp_arr + begin * size_of_element;
+    size_t total_count = left_count + right_count;
+    char *removed = dest + total_count * size_of_element;
+
+    while (left < left_end && right < right_end)
+    {
+        int result = sort_compare(cmp_func_ptr, left, right);
+        if (result < 0)
+        {
+            sort_memcpy(dest, left, size_of_element);
+            left += size_of_element;
+        }
+        else if (result > 0)
+        {
+            sort_memcpy(dest, right, size_of_element);
+            right += size_of_element;
+        }
+        else
+        {
+            sort_memcpy(dest, left, size_of_element);
+            left += size_of_element;
+            if (keep_removed)
+            {
+                removed -= size_of_element;
+                sort_memcpy(removed, right, size_of_element);
+            }
+            right += size_of_element;
+        }
+        dest += size_of_element;
+    }
+    if (left < left_end)
+    {
+        sort_memcpy(dest, left, left_end - left);
+        dest += left_end - left;
+    }
+    if (right < right_end)
+    {
+        sort_memcpy(dest, right, right_end - right);
+        dest += right_end - right;
+    }
+
+    char *merged = tmp_arr + begin * size_of_element;
+    size_t num_unique = (size_t)(dest - merged) / size_of_element;
+    if (keep_removed)
+    {
+        /* 양쪽 구간에 이미 모여 있던 제거된 원소를 이번에 제거된 원소 앞으로 옮김 */
+        size_t left_removed = left_count - left_unique;
+        size_t right_removed = right_count - right_unique;
+        sort_memcpy(dest, left_end, left_removed * size_of_element);
+        sort_memcpy(dest + left_removed * size_of_element, right_end, right_removed * size_of_element);
+        sort_memcpy(arr + begin * size_of_element, merged, total_count * size_of_element);
+    }
+    else
+    {
+        sort_memcpy(arr + begin * size_of_element, merged, num_unique * size_of_element);
+    }
+    return num_unique;
+}
+
+static SORT_THREAD_PROC unique_sort_chunk(void *arg)
+{
+    UniqueArg *arg_ptr = (UniqueArg *)arg;
+    arg_ptr->num_unique = unique_sort_range(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->cmp_func_ptr, arg_ptr->keep_removed, arg_ptr->begin, arg_ptr->count);
+    return 0;
+}
+
+static SORT_THREAD_PROC unique_merge_pair(void *arg)
+{
+    UniqueArg *arg_ptr = (UniqueArg *)arg;
+    arg_ptr->num_unique = unique_merge(arg_ptr->arr, arg_ptr->tmp_arr, arg_ptr->size_of_element, arg_ptr->cmp_func_ptr, arg_ptr->keep_removed, arg_ptr->begin, arg_ptr->count, arg_ptr->num_unique, arg_ptr->right_count, arg_ptr->right_unique);
+    arg_ptr->count += arg_ptr->right_count;
+    return 0;
+}
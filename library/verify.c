@@ -0,0 +1,393 @@
+/**
+ * @file verify.c
+ * @brief 정렬 결과 검증 (정렬 여부, 순열 체크섬, 안정성)
+ *
+ * 모든 검사는 배열을 작업 스레드 수만큼 나눠 병렬로 처리하며,
+ * 정렬 여부 검사는 한 스레드가 어긋난 곳을 찾으면 다른 스레드도 다음 블록에서 멈춤
+ */
+
+#include <stdint.h>
+#include "sorting.h"
+#include "sort_internal.h"
+
+/* 다른 스레드가 어긋난 곳을 찾았는지 확인하는 간격 (원소 수) */
+#define VERIFY_BLOCK ((size_t)1 << 14)
+
+typedef enum VerifyModeEnum
+{
+    VERIFY_SORTED,          // 비교 함수로 인접한 두 원소 비교
+    VERIFY_SORTED_KEY,      // 기본 자료형 값 비교 (비교 함수 호출 없음)
+    VERIFY_CHECKSUM,
+    VERIFY_EQUAL            // 두 배열이 바이트 단위로 같은지 비교
+} VerifyMode;
+
+/* 작업 스레드 인자 구조체 */
+typedef struct VerifyArgStruct
+{
+    VerifyMode mode;
+    const char *arr;
+    const char *other;              // VERIFY_EQUAL에서 비교할 배열
+    size_t size_of_element;
+    size_t begin;                   // 정렬 여부 검사는 [begin, end)의 각 원소를 바로 앞 원소와 비교
+    size_t end;
+    CmpFunc cmp_func_ptr;
+    SortKeyType key_type;
+    volatile size_t *mismatch_flag; // 어긋난 곳을 찾으면 1 (모든 스레드가 공유)
+    uint64_t checksum;              // VERIFY_CHECKSUM 결과 (구간의 합)
+} VerifyArg;
+
+static int run_verify(VerifyMode mode, const void *arr, const void *other, size_t num_of_elements, size_t size_of_element,
+                      CmpFunc cmp_func_ptr, SortKeyType key_type, uint64_t *out_checksum);
+static SORT_THREAD_PROC verify_worker(void *arg);
+static int has_key_descent(const char *arr, SortKeyType key_type, size_t begin, size_t end);
+static uint64_t hash_element(const unsigned char *element, size_t size_of_element);
+static inline int compare_index(const char *arr, size_t size_of_element, CmpFunc cmp_func_ptr, size_t a, size_t b);
+static void heap_sort_index(size_t *index, size_t num_of_elements, const char *arr, size_t size_of_element, CmpFunc cmp_func_ptr);
+
+/* [공개 함수] 정렬 여부 확인 */
+int sort_is_sorted(const void *arr, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements < 2))
+    {
+        return 1;
+    }
+    return run_verify(VERIFY_SORTED, arr, NULL, num_of_elements, size_of_element, cmp_func_ptr, SORT_KEY_INT32, NULL);
+}
+
+/* [공개 함수] 기본 자료형 배열의 정렬 여부 확인 */
+int sort_is_sorted_key(const void *arr, size_t num_of_elements, SortKeyType key_type)
+{
+    if (SORT_UNLIKELY((unsigned)key_type >= SORT_KEY_STRING))
+    {
+        return -1;
+    }
+    if (SORT_UNLIKELY(arr == NULL || num_of_elements < 2))
+    {
+        return 1;
+    }
+    return run_verify(VERIFY_SORTED_KEY, arr, NULL, num_of_elements, 0, NULL, key_type, NULL);
+}
+
+/* [공개 함수] 순서와 무관한 체크섬 */
+unsigned long long sort_checksum(const void *arr, size_t num_of_elements, size_t size_of_element)
+{
+    uint64_t checksum = 0;
+    if (SORT_LIKELY(arr != NULL && size_of_element > 0))
+    {
+        run_verify(VERIFY_CHECKSUM, arr, NULL, num_of_elements, size_of_element, NULL, SORT_KEY_INT32, &checksum);
+    }
+    return (unsigned long long)checksum;
+}
+
+/* [공개 함수] 안정 정렬 결과인지 확인 */
+int sort_verify_stable(const void *original, const void *sorted, size_t num_of_elements, size_t size_of_element, int (*cmp_func_ptr)(const void *a_ptr, const void *b_ptr))
+{
+    if (SORT_UNLIKELY(num_of_elements == 0 || size_of_element == 0))
+    {
+        return 1;
+    }
+    /*
+     * 안정 정렬의 결과는 하나뿐이므로, 같은 원소를 원래 위치로 구분하는 비교로 인덱스를 힙 정렬하여 기준을 만듦
+     * (어떤 알고리즘으로 만들어도 같은 순서가 되므로, 검사 대상인 병합 정렬 코드와 무관하게 검증할 수 있음)
+     */
+    char *expected = (char *)sort_malloc(num_of_elements * size_of_element);
+    size_t *index = (size_t *)sort_malloc(num_of_elements * sizeof(size_t));
+    if (SORT_UNLIKELY(expected == NULL || index == NULL))
+    {
+        sort_free(expected);
+        sort_free(index);
+        return -1;
+    }
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        index[i] = i;
+    }
+    heap_sort_index(index, num_of_elements, (const char *)original, size_of_element, cmp_func_ptr);
+    for (size_t i = 0; i < num_of_elements; i++)
+    {
+        sort_memcpy(expected + i * size_of_element, (const char *)original + index[i] * size_of_element, size_of_element);
+    }
+    sort_free(index);
+    int is_equal = run_verify(VERIFY_EQUAL, expected, sorted, num_of_elements, size_of_element, NULL, SORT_KEY_INT32, NULL);
+    sort_free(expected);
+    return is_equal;
+}
+
+/* 구간을 나눠 병렬 검사, 어긋난 곳이 없으면 1 (체크섬은 항상 1) */
+static int run_verify(VerifyMode mode, const void *arr, const void *other, size_t num_of_elements, size_t size_of_element,
+                      CmpFunc cmp_func_ptr, SortKeyType key_type, uint64_t *out_checksum)
+{
+    int num_workers = (num_of_elements < SORT_PARALLEL_THRESHOLD) ? 1 : sort_worker_count();
+    if ((size_t)num_workers > num_of_elements / VERIFY_BLOCK + 1)
+    {
+        num_workers = (int)(num_of_elements / VERIFY_BLOCK + 1);
+    }
+    VerifyArg single_arg;
+    VerifyArg *args = (num_workers > 1) ? (VerifyArg *)sort_malloc((size_t)num_workers * sizeof(VerifyArg)) : &single_arg;
+    if (SORT_UNLIKELY(args == NULL))
+    {
+        args = &single_arg;
+        num_workers = 1;
+    }
+    volatile size_t mismatch_flag = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        args[t].mode = mode;
+        args[t].arr = (const char *)arr;
+        args[t].other = (const char *)other;
+        args[t].size_of_element = size_of_element;
+        args[t].begin = num_of_elements * (size_t)t / (size_t)num_workers;
+        args[t].end = num_of_elements * (size_t)(t + 1) / (size_t)num_workers;
+        args[t].cmp_func_ptr = cmp_func_ptr;
+        args[t].key_type = key_type;
+        args[t].mismatch_flag = &mismatch_flag;
+        args[t].checksum = 0;
+    }
+    if (mode == VERIFY_SORTED || mode == VERIFY_SORTED_KEY)
+    {
+        args[0].begin = 1; // 첫 원소는 앞 원소가 없음
+    }
+    sort_run_workers(verify_worker, args, sizeof(VerifyArg), num_workers);
+
+    uint64_t checksum = 0;
+    for (int t = 0; t < num_workers; t++)
+    {
+        checksum += args[t].checksum;
+    }
+    if (out_checksum != NULL)
+    {
+        *out_checksum = checksum;
+    }
+    if (args != &single_arg)
+    {
+        sort_free(args);
+    }
+    return (sort_atomic_fetch_add(&mismatch_flag, 0) != 0) ? 0 : 1;
+}
+
+static SORT_THREAD_PROC verify_worker(void *arg)
+{
+    VerifyArg *arg_ptr = (VerifyArg *)arg;
+    const char *arr = arg_ptr->arr;
+    size_t size = arg_ptr->size_of_element;
+    for (size_t block = arg_ptr->begin; block < arg_ptr->end; block += VERIFY_BLOCK)
+    {
+        if (sort_atomic_fetch_add(arg_ptr->mismatch_flag, 0) != 0)
+        {
+            return 0;
+        }
+        size_t block_end = (arg_ptr->end - block > VERIFY_BLOCK) ? block + VERIFY_BLOCK : arg_ptr->end;
+        int is_mismatch = 0;
+        switch (arg_ptr->mode)
+        {
+        case VERIFY_SORTED:
+            for (size_t i = block; i < block_end && !is_mismatch; i++)
+            {
+                is_mismatch = (sort_compare(arg_ptr->cmp_func_ptr, arr + (i - 1) * size, arr + i * size) > 0);
+            }
+            break;
+        case VERIFY_SORTED_KEY:
+            is_mismatch = has_key_descent(arr, arg_ptr->key_type, block, block_end);
+            break;
+        case VERIFY_CHECKSUM:
+        {
+            uint64_t checksum = 0;
+            for (size_t i = block; i < block_end; i++)
+            {
+                checksum += hash_element((const unsigned char *)arr + i * size, size);
+            }
+            arg_ptr->checksum += checksum;
+            break;
+        }
+        case VERIFY_EQUAL:
+            is_mismatch = (memcmp(arr + block * size, arg_ptr->other + block * size, (block_end - block) * size) != 0);
+            break;
+        }
+        if (is_mismatch)
+        {
+            sort_atomic_compare_exchange(arg_ptr->mismatch_flag, 0, 1);
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/*
+ * [begin, end)에서 앞 원소보다 작은 원소가 있으면 1
+ * 분기 없이 블록 전체를 OR로 모으므로 컴파일러가 SIMD 명령으로 벡터화할 수 있음 (실수의 NaN은 검사하지 않음)
+ */
+static int has_key_descent(const char *arr, SortKeyType key_type, size_t begin, size_t end)
+{
+    int is_descent = 0;
+    switch (key_type)
+    {
+    case SORT_KEY_INT8:
+    {
+        const int8_t *a = (const int8_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_INT16:
+    {
+        const int16_t *a = (const int16_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_INT32:
+    {
+        const int32_t *a = (const int32_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_INT64:
+    {
+        const int64_t *a = (const int64_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_UINT8:
+    {
+        const uint8_t *a = (const uint8_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_UINT16:
+    {
+        const uint16_t *a = (const uint16_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_UINT32:
+    {
+        const uint32_t *a = (const uint32_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_UINT64:
+    {
+        const uint64_t *a = (const uint64_t *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_FLOAT:
+    {
+        const float *a = (const float *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    case SORT_KEY_DOUBLE:
+    {
+        const double *a = (const double *)arr;
+        for (size_t i = begin; i < end; i++)
+        {
+            is_descent |= (a[i] < a[i - 1]);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return is_descent;
+}
+
+/* 원소의 모든 바이트(구조체 패딩 포함)로 만든 64비트 해시, 8바이트씩 섞은 뒤 splitmix64 마무리 */
+static uint64_t hash_element(const unsigned char *element, size_t size_of_element)
+{
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)size_of_element;
+    size_t i = 0;
+    for (; i + 8 <= size_of_element; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, element + i, 8);
+        hash = (hash ^ word) * 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 31;
+    }
+    if (i < size_of_element)
+    {
+        uint64_t word = 0;
+        memcpy(&word, element + i, size_of_element - i);
+        hash = (hash ^ word) * 0x94D049BB133111EBULL;
+        hash ^= hash >> 29;
+    }
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+    return hash;
+}
+
+/* 원소 a, b를 비교하고, 같으면 원래 위치가 앞인 쪽을 작은 것으로 봄 */
+static inline int compare_index(const char *arr, size_t size_of_element, CmpFunc cmp_func_ptr, size_t a, size_t b)
+{
+    int result = sort_compare(cmp_func_ptr, arr + a * size_of_element, arr + b * size_of_element);
+    if (result != 0)
+    {
+        return result;
+    }
+    return (a > b) - (a < b);
+}
+
+/* arr의 원소 순서대로 인덱스 배열을 힙 정렬 (병합 정렬 코드를 쓰지 않는 안정성 검증 기준) */
+static void heap_sort_index(size_t *index, size_t num_of_elements, const char *arr, size_t size_of_element, CmpFunc cmp_func_ptr)
+{
+    for (size_t end = num_of_elements, start = num_of_elements / 2; end > 1;)
+    {
+        /* 앞 절반은 힙을 만들고, 이후에는 최댓값을 끝으로 보낸 뒤 루트를 내림 */
+        size_t root;
+        if (start > 0)
+        {
+            root = --start;
+        }
+        else
+        {
+            end--;
+            size_t temp = index[0];
+            index[0] = index[end];
+            index[end] = temp;
+            root = 0;
+        }
+        size_t value = index[root];
+        for (size_t child = 2 * root + 1; child < end; child = 2 * root + 1)
+        {
+            if (child + 1 < end && compare_index(arr, size_of_element, cmp_func_ptr, index[child], index[child + 1]) < 0)
+            {
+                child++;
+            }
+            if (compare_index(arr, size_of_element, cmp_func_ptr, value, index[child]) >= 0)
+            {
+                break;
+            }
+            index[root] = index[child];
+            root = child;
+        }
+        index[root] = value;
+    }
+}